@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/hot_path_counters.h"
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/driver/driver.h"
@@ -14,6 +15,7 @@
 
 #include "driver_version.h"
 
+#include <algorithm>
 #include <string>
 
 namespace L0 {
@@ -41,6 +43,34 @@ zexDriverGetHostPointerBaseAddress(
     return L0::DriverHandle::fromHandle(toInternalType(hDriver))->getHostPointerBaseAddress(ptr, baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexDriverGetHotPathCounters(
+    ze_driver_handle_t hDriver,
+    uint32_t *pCount,
+    const char **pNames,
+    uint64_t *pValues) {
+    if (hDriver == nullptr || pCount == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (*pCount == 0) {
+        *pCount = NEO::HotPathCounters::Counter::count;
+        return ZE_RESULT_SUCCESS;
+    }
+    *pCount = std::min(*pCount, static_cast<uint32_t>(NEO::HotPathCounters::Counter::count));
+
+    uint64_t values[NEO::HotPathCounters::Counter::count];
+    NEO::HotPathCounters::getAll(values);
+    for (uint32_t i = 0; i < *pCount; i++) {
+        if (pNames) {
+            pNames[i] = NEO::HotPathCounters::getName(static_cast<NEO::HotPathCounters::Counter>(i));
+        }
+        if (pValues) {
+            pValues[i] = values[i];
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
 
 ze_result_t ZE_APICALL
@@ -86,4 +116,13 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress) {
     return L0::zexDriverGetHostPointerBaseAddress(hDriver, ptr, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDriverGetHotPathCounters(
+    ze_driver_handle_t hDriver,
+    uint32_t *pCount,
+    const char **pNames,
+    uint64_t *pValues) {
+    return L0::zexDriverGetHotPathCounters(hDriver, pCount, pNames, pValues);
+}
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,14 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress          ///< [out] if not null, returns address of the base pointer of the imported pointer
 );
 
+ze_result_t ZE_APICALL
+zexDriverGetHotPathCounters(
+    ze_driver_handle_t hDriver, ///< [in] handle of the driver
+    uint32_t *pCount,           ///< [in,out] number of counters; if 0, returns number of available counters
+    const char **pNames,        ///< [out][optional] names of the counters
+    uint64_t *pValues           ///< [out][optional] process wide values of the counters
+);
+
 } // namespace L0
 
 #endif // _ZEX_DRIVER_H
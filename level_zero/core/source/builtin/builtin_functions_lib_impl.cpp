@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -293,32 +293,31 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
         return nullptr;
     }
 
-    StackVec<BuiltInCodeType, 2> supportedTypes{};
-    if (!NEO::debugManager.flags.RebuildPrecompiledKernels.get()) {
-        supportedTypes.push_back(BuiltInCodeType::binary);
+    if (this->modules.size() <= builtin) {
+        this->modules.resize(builtin + 1u);
     }
-    supportedTypes.push_back(BuiltInCodeType::intermediate);
-
-    NEO::BuiltinCode builtinCode{};
 
-    for (auto &builtinCodeType : supportedTypes) {
-        builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtinCodeType, *device->getNEODevice());
-        if (!builtinCode.resource.empty()) {
-            break;
+    if (this->modules[builtin].get() == nullptr) {
+        StackVec<BuiltInCodeType, 2> supportedTypes{};
+        if (!NEO::debugManager.flags.RebuildPrecompiledKernels.get()) {
+            supportedTypes.push_back(BuiltInCodeType::binary);
         }
-    }
+        supportedTypes.push_back(BuiltInCodeType::intermediate);
 
-    if (builtinCode.resource.empty()) {
-        return nullptr;
-    }
+        NEO::BuiltinCode builtinCode{};
 
-    [[maybe_unused]] ze_result_t res;
+        for (auto &builtinCodeType : supportedTypes) {
+            builtinCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtinCodeType, *device->getNEODevice());
+            if (!builtinCode.resource.empty()) {
+                break;
+            }
+        }
 
-    if (this->modules.size() <= builtin) {
-        this->modules.resize(builtin + 1u);
-    }
+        if (builtinCode.resource.empty()) {
+            return nullptr;
+        }
 
-    if (this->modules[builtin].get() == nullptr) {
+        [[maybe_unused]] ze_result_t res;
         std::unique_ptr<Module> module;
         ze_module_handle_t moduleHandle;
         ze_module_desc_t moduleDesc = {};
@@ -329,9 +328,20 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
         UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
 
         module.reset(Module::fromHandle(moduleHandle));
+
+        if (builtinCode.type != BuiltInCodeType::binary) {
+            size_t nativeBinarySize = 0;
+            if (module->getNativeBinary(&nativeBinarySize, nullptr) == ZE_RESULT_SUCCESS && nativeBinarySize > 0) {
+                auto nativeBinary = std::make_unique<uint8_t[]>(nativeBinarySize);
+                module->getNativeBinary(&nativeBinarySize, nativeBinary.get());
+                builtInsLib->getBuiltinsLib().registerCompiledBuiltin(builtin, *device->getNEODevice(), reinterpret_cast<const char *>(nativeBinary.get()), nativeBinarySize);
+            }
+        }
+
         this->modules[builtin] = std::move(module);
     }
 
+    [[maybe_unused]] ze_result_t res;
     std::unique_ptr<Kernel> kernel;
     ze_kernel_handle_t kernelHandle;
     ze_kernel_desc_t kernelDesc = {};
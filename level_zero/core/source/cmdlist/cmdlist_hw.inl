@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,10 +74,7 @@ inline ze_result_t parseErrorCode(NEO::CommandContainer::ErrorCode returnValue)
 template <GFXCORE_FAMILY gfxCoreFamily>
 CommandListCoreFamily<gfxCoreFamily>::~CommandListCoreFamily() {
     clearCommandsToPatch();
-    for (auto &alloc : this->ownedPrivateAllocations) {
-        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(alloc.second);
-    }
-    this->ownedPrivateAllocations.clear();
+    releaseOwnedPrivateAllocations();
     for (auto &patternAlloc : this->patternAllocations) {
         device->storeReusableAllocation(*patternAlloc);
     }
@@ -136,10 +133,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
         this->returnPoints.clear();
     }
 
-    for (auto &alloc : this->ownedPrivateAllocations) {
-        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(alloc.second);
-    }
-    this->ownedPrivateAllocations.clear();
+    releaseOwnedPrivateAllocations();
     cmdListCurrentStartOffset = 0;
 
     mappedTsEventList.clear();
@@ -3800,13 +3794,38 @@ void CommandListCoreFamily<gfxCoreFamily>::allocateOrReuseKernelPrivateMemory(Ke
         }
     }
     if (!allocToReuseFound) {
-        privateAlloc = kernelImp->allocatePrivateMemoryGraphicsAllocation();
+        privateAlloc = obtainReusablePrivateAllocation(sizePerHwThread);
+        if (privateAlloc == nullptr) {
+            privateAlloc = kernelImp->allocatePrivateMemoryGraphicsAllocation();
+        }
         privateAllocsToReuse.push_back({sizePerHwThread, privateAlloc});
         this->commandContainer.addToResidencyContainer(privateAlloc);
     }
     kernel->patchCrossthreadDataWithPrivateAllocation(privateAlloc);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+NEO::GraphicsAllocation *CommandListCoreFamily<gfxCoreFamily>::obtainReusablePrivateAllocation(uint32_t sizePerHwThread) {
+    if (NEO::debugManager.flags.EnableDevicePrivateMemoryReuse.get() != 1) {
+        return nullptr;
+    }
+    auto privateSurfaceSize = NEO::KernelHelper::getPrivateSurfaceSize(sizePerHwThread, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch);
+    return device->obtainReusablePrivateAllocation(privateSurfaceSize);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::releaseOwnedPrivateAllocations() {
+    const bool reuseOnDevice = NEO::debugManager.flags.EnableDevicePrivateMemoryReuse.get() == 1;
+    for (auto &alloc : this->ownedPrivateAllocations) {
+        if (reuseOnDevice) {
+            device->storeReusablePrivateAllocation(*alloc.second);
+        } else {
+            device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(alloc.second);
+        }
+    }
+    this->ownedPrivateAllocations.clear();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 CmdListEventOperation CommandListCoreFamily<gfxCoreFamily>::estimateEventPostSync(Event *event, uint32_t operations) {
     CmdListEventOperation ret;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -218,6 +218,10 @@ void CommandQueueImp::postSyncOperations(bool hangDetected) {
         device->getL0Debugger()->printTrackedAddresses(csr->getOsContext().getContextId());
     }
 
+    if (!hangDetected) {
+        csr->releaseScratchSpaceIfIdle();
+    }
+
     unregisterCsrClient();
 }
 
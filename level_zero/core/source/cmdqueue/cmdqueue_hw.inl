@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -342,6 +342,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
     this->makeSbaTrackingBufferResidentIfL0DebuggerEnabled(ctx.isDebugEnabled);
     this->makeCsrTagAllocationResident();
 
+    bool firstPipelineSelectProgrammed = false;
     if (ctx.globalInit) {
         if (stateCacheFlushRequired) {
             NEO::MemorySynchronizationCommands<GfxFamily>::addStateCacheFlush(*streamForDispatch, neoDevice->getRootDeviceEnvironment());
@@ -365,6 +366,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
                 if (firstCmdListWithStateChange.cmdListIndex == 0 && firstCmdListWithStateChange.flags.propertyPsDirty) {
                     this->programOneCmdListPipelineSelect(*streamForDispatch, firstCmdListWithStateChange);
                     firstCmdListWithStateChange.flags.propertyPsDirty = false;
+                    firstPipelineSelectProgrammed = true;
                 }
             }
         }
@@ -386,6 +388,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
         this->programStateSip(ctx.stateSipRequired, *streamForDispatch);
         this->programActivePartitionConfig(ctx.isProgramActivePartitionConfigRequired, *streamForDispatch);
         bool shouldProgramVfe = !frontEndTrackingEnabled() && ctx.frontEndStateDirty;
+        if (!frontEndTrackingEnabled() && !shouldProgramVfe) {
+            this->csr->getStateCommandStatistics().record(NEO::StateCommandType::frontEnd, false);
+        }
         this->programFrontEndAndClearDirtyFlag(shouldProgramVfe, ctx, *streamForDispatch, csr->getStreamProperties());
 
         if (ctx.rtDispatchRequired) {
@@ -399,6 +404,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
 
         ctx.childGpuAddressPositionBeforeDynamicPreamble = (*streamForDispatch).getCurrentGpuAddressPosition();
 
+        CommandListRequiredStateChange *cmdListStateChange = nullptr;
         if (this->stateChanges.size() > this->currentStateChangeIndex) {
             auto &stateChange = this->stateChanges[this->currentStateChangeIndex];
             if (stateChange.cmdListIndex == i) {
@@ -409,9 +415,11 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
                 this->programRequiredStateComputeModeForCommandList(*streamForDispatch, stateChange);
                 this->programRequiredStateBaseAddressForCommandList(ctx, *streamForDispatch, stateChange);
 
+                cmdListStateChange = &stateChange;
                 this->currentStateChangeIndex++;
             }
         }
+        this->recordElidedStateCommandsForCommandList(cmdListStateChange, i == 0 && firstPipelineSelectProgrammed);
 
         this->patchCommands(*commandList, ctx);
         this->programOneCmdListBatchBufferStart(commandList, *streamForDispatch, ctx);
@@ -598,6 +606,7 @@ void CommandQueueHw<gfxCoreFamily>::programFrontEnd(uint64_t scratchAddress, uin
                                                     device->getMaxNumHwThreads(),
                                                     streamProperties);
     csr->setMediaVFEStateDirty(false);
+    csr->getStateCommandStatistics().record(NEO::StateCommandType::frontEnd, true);
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -674,6 +683,7 @@ void CommandQueueHw<gfxCoreFamily>::programPipelineSelectIfGpgpuDisabled(NEO::Li
         NEO::PreambleHelper<GfxFamily>::programPipelineSelect(&cmdStream, args, device->getNEODevice()->getRootDeviceEnvironment());
         this->csr->setPreambleSetFlag(true);
     }
+    this->csr->getStateCommandStatistics().record(NEO::StateCommandType::pipelineSelect, !gpgpuEnabled);
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -918,6 +928,10 @@ void CommandQueueHw<gfxCoreFamily>::handleScratchSpaceAndUpdateGSBAStateDirtyFla
         defaultCsrLock = device->getNEODevice()->getDefaultEngine().commandStreamReceiver->obtainUniqueOwnership();
     }
 
+    if (ctx.perThreadScratchSpaceSlot0Size > 0 || ctx.perThreadScratchSpaceSlot1Size > 0) {
+        this->csr->markScratchSpaceUsed();
+    }
+
     bool localGsbaDirty = false;
     bool localFrontEndDirty = false;
     handleScratchSpace(this->heapContainer,
@@ -1098,6 +1112,7 @@ void CommandQueueHw<gfxCoreFamily>::programStateBaseAddressWithGsbaIfDirty(
     ze_command_list_handle_t hCommandList,
     NEO::LinearStream &cmdStream) {
 
+    this->csr->getStateCommandStatistics().record(NEO::StateCommandType::stateBaseAddress, ctx.gsbaStateDirty);
     if (!ctx.gsbaStateDirty) {
         return;
     }
@@ -1564,6 +1579,7 @@ void CommandQueueHw<gfxCoreFamily>::programOneCmdListPipelineSelect(NEO::LinearS
 
         NEO::PreambleHelper<GfxFamily>::programPipelineSelect(&commandStream, args, device->getNEODevice()->getRootDeviceEnvironment());
         csr->setPreambleSetFlag(true);
+        csr->getStateCommandStatistics().record(NEO::StateCommandType::pipelineSelect, true);
     }
 }
 
@@ -1624,6 +1640,7 @@ void CommandQueueHw<gfxCoreFamily>::programRequiredStateComputeModeForCommandLis
                                                                                         false, device->getNEODevice()->getRootDeviceEnvironment(), this->csr->isRcs(),
                                                                                         this->csr->getDcFlushSupport());
         this->csr->setStateComputeModeDirty(false);
+        this->csr->getStateCommandStatistics().record(NEO::StateCommandType::stateComputeMode, true);
     }
 }
 
@@ -1645,6 +1662,25 @@ void CommandQueueHw<gfxCoreFamily>::programRequiredStateBaseAddressForCommandLis
                                 &cmdListRequired.requiredState);
 
         ctx.gsbaStateDirty = false;
+        this->csr->getStateCommandStatistics().record(NEO::StateCommandType::stateBaseAddress, true);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::recordElidedStateCommandsForCommandList(const CommandListRequiredStateChange *cmdListRequired,
+                                                                            bool pipelineSelectProgrammed) {
+    auto &statistics = this->csr->getStateCommandStatistics();
+    if (this->pipelineSelectStateTracking && !pipelineSelectProgrammed && (cmdListRequired == nullptr || !cmdListRequired->flags.propertyPsDirty)) {
+        statistics.record(NEO::StateCommandType::pipelineSelect, false);
+    }
+    if (frontEndTrackingEnabled() && (cmdListRequired == nullptr || !cmdListRequired->flags.propertyFeDirty)) {
+        statistics.record(NEO::StateCommandType::frontEnd, false);
+    }
+    if (this->stateComputeModeTracking && (cmdListRequired == nullptr || !cmdListRequired->flags.propertyScmDirty)) {
+        statistics.record(NEO::StateCommandType::stateComputeMode, false);
+    }
+    if (this->stateBaseAddressTracking && (cmdListRequired == nullptr || !cmdListRequired->flags.propertySbaDirty)) {
+        statistics.record(NEO::StateCommandType::stateBaseAddress, false);
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/in_order_cmd_helpers.h"
+#include "shared/source/memory_manager/memory_manager.h"
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
@@ -99,4 +100,51 @@ void Device::ensureSyncDispatchTokenAllocation() {
     }
 }
 
+NEO::GraphicsAllocation *Device::obtainReusablePrivateAllocation(size_t requiredSize) {
+    std::lock_guard<std::mutex> lock(privateAllocationsForReuseMutex);
+
+    // best fit within the size class, so a small dispatch does not pin a much larger surface
+    auto bestFit = privateAllocationsForReuse.end();
+    for (auto it = privateAllocationsForReuse.begin(); it != privateAllocationsForReuse.end(); it++) {
+        auto size = (*it)->getUnderlyingBufferSize();
+        if (size < requiredSize || size > 2 * requiredSize) {
+            continue;
+        }
+        if (bestFit == privateAllocationsForReuse.end() || size < (*bestFit)->getUnderlyingBufferSize()) {
+            bestFit = it;
+        }
+    }
+    if (bestFit == privateAllocationsForReuse.end()) {
+        return nullptr;
+    }
+
+    auto allocation = *bestFit;
+    privateAllocationsForReuse.erase(bestFit);
+    reusedPrivateMemorySize += allocation->getUnderlyingBufferSize();
+    return allocation;
+}
+
+void Device::storeReusablePrivateAllocation(NEO::GraphicsAllocation &alloc) {
+    NEO::GraphicsAllocation *allocationToFree = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(privateAllocationsForReuseMutex);
+        privateAllocationsForReuse.push_back(&alloc);
+        if (privateAllocationsForReuse.size() > maxPrivateAllocationsForReuse) {
+            allocationToFree = privateAllocationsForReuse.front();
+            privateAllocationsForReuse.erase(privateAllocationsForReuse.begin());
+        }
+    }
+    if (allocationToFree) {
+        getNEODevice()->getMemoryManager()->freeGraphicsMemory(allocationToFree);
+    }
+}
+
+void Device::freePrivateAllocationsForReuse() {
+    std::lock_guard<std::mutex> lock(privateAllocationsForReuseMutex);
+    for (auto allocation : privateAllocationsForReuse) {
+        getNEODevice()->getMemoryManager()->freeGraphicsMemory(allocation);
+    }
+    privateAllocationsForReuse.clear();
+}
+
 } // namespace L0
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 static_assert(NEO::ProductHelper::uuidSize == ZE_MAX_DEVICE_UUID_SIZE);
 
@@ -158,6 +159,12 @@ struct Device : _ze_device_handle_t {
     NEO::GraphicsAllocation *getSyncDispatchTokenAllocation() const { return syncDispatchTokenAllocation; }
     uint32_t getNextSyncDispatchQueueId();
     void ensureSyncDispatchTokenAllocation();
+    NEO::GraphicsAllocation *obtainReusablePrivateAllocation(size_t requiredSize);
+    void storeReusablePrivateAllocation(NEO::GraphicsAllocation &alloc);
+    void freePrivateAllocationsForReuse();
+    size_t getReusedPrivateMemorySize() const { return reusedPrivateMemorySize; }
+
+    static constexpr size_t maxPrivateAllocationsForReuse = 8u;
 
   protected:
     NEO::Device *neoDevice = nullptr;
@@ -167,7 +174,10 @@ struct Device : _ze_device_handle_t {
     NEO::GraphicsAllocation *syncDispatchTokenAllocation = nullptr;
     std::mutex inOrderAllocatorMutex;
     std::mutex syncDispatchTokenMutex;
+    std::mutex privateAllocationsForReuseMutex;
+    std::vector<NEO::GraphicsAllocation *> privateAllocationsForReuse;
     std::atomic<uint32_t> syncDispatchQueueIdAllocator = 0;
+    std::atomic<size_t> reusedPrivateMemorySize = 0;
     bool implicitScalingCapable = false;
 };
 
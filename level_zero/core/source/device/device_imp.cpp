@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1649,6 +1649,9 @@ void DeviceImp::releaseResources() {
         allocationsForReuse->freeAllGraphicsAllocations(neoDevice);
         allocationsForReuse.reset();
     }
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get() && getReusedPrivateMemorySize() > 0, stderr,
+                       "Private memory reused across command lists: %zu bytes\n", getReusedPrivateMemorySize());
+    freePrivateAllocationsForReuse();
 
     neoDevice->decRefInternal();
     neoDevice = nullptr;
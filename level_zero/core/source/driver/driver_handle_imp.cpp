@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 #include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/image/image.h"
+#include "level_zero/core/source/module/module_build_worker_pool.h"
 
 #include "driver_version.h"
 
@@ -183,6 +184,8 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
 }
 
 DriverHandleImp::~DriverHandleImp() {
+    this->moduleBuildWorkerPool.reset();
+
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
@@ -408,6 +411,17 @@ void DriverHandleImp::initHostUsmAllocPool() {
     }
 }
 
+ModuleBuildWorkerPool *DriverHandleImp::getModuleBuildWorkerPool() {
+    if (NEO::debugManager.flags.ModuleBuildWorkerThreads.get() <= 0) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(this->moduleBuildWorkerPoolMutex);
+    if (this->moduleBuildWorkerPool == nullptr) {
+        this->moduleBuildWorkerPool = std::make_unique<ModuleBuildWorkerPool>(static_cast<uint32_t>(NEO::debugManager.flags.ModuleBuildWorkerThreads.get()));
+    }
+    return this->moduleBuildWorkerPool.get();
+}
+
 ze_result_t DriverHandleImp::getDevice(uint32_t *pCount, ze_device_handle_t *phDevices) {
     bool exposeSubDevices = false;
 
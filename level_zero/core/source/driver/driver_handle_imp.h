@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
 
 namespace L0 {
 class HostPointerManager;
+class ModuleBuildWorkerPool;
 struct FabricVertex;
 struct FabricEdge;
 struct Image;
@@ -129,8 +130,11 @@ struct DriverHandleImp : public DriverHandle {
     std::map<uint64_t, IpcHandleTracking *> &getIPCHandleMap() { return this->ipcHandles; };
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
     void initHostUsmAllocPool();
+    ModuleBuildWorkerPool *getModuleBuildWorkerPool();
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<ModuleBuildWorkerPool> moduleBuildWorkerPool;
+    std::mutex moduleBuildWorkerPoolMutex;
 
     std::mutex sharedMakeResidentAllocationsLock;
     std::map<void *, NEO::GraphicsAllocation *> sharedMakeResidentAllocations;
@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/worker_pool.h"
+
+namespace L0 {
+
+// Driver owned threads building user modules in background.
+class ModuleBuildWorkerPool : public NEO::WorkerPool {
+  public:
+    using NEO::WorkerPool::WorkerPool;
+};
+
+} // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,10 +49,12 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
+#include "level_zero/core/source/module/module_build_worker_pool.h"
 
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -374,6 +376,7 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     NEO::DecodeError decodeError;
     NEO::DeviceBinaryFormat singleDeviceBinaryFormat;
     auto &gfxCoreHelper = device->getGfxCoreHelper();
+    programInfo.workerPool = device->getNEODevice()->getExecutionEnvironment()->getKernelDecodeWorkerPool();
     std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
     if (decodeWarnings.empty() == false) {
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
@@ -510,6 +513,8 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 }
 
 ModuleImp::~ModuleImp() {
+    this->waitForBuildCompletion();
+
     for (auto &kernel : this->printfKernelContainer) {
         if (kernel.get() != nullptr) {
             destroyPrintfKernel(kernel->toHandle());
@@ -568,6 +573,13 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
 
     checkIfPrivateMemoryPerDispatchIsNeeded();
 
+    // only the copy of ISA is deferred, ISA allocations are created with the module because linking needs their GPU addresses;
+    // kernels sharing an ISA pool chunk are copied in a single transfer, so lazy upload does not apply to them
+    this->lazyIsaUpload = (NEO::debugManager.flags.EnableLazyKernelIsaUpload.get() == 1) &&
+                          this->type == ModuleType::user &&
+                          this->sharedIsaAllocation == nullptr &&
+                          this->device->getL0Debugger() == nullptr;
+
     linkageSuccessful = this->linkBinary();
 
     linkageSuccessful &= populateHostGlobalSymbolsMap(this->translationUnit->programInfo.globalsDeviceToHostNameMap);
@@ -628,25 +640,62 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->setIsaCopiedToAllocation();
         }
     } else {
+        std::lock_guard<std::mutex> lock(this->lazyIsaUploadMutex);
         for (auto &kernelImmData : kernelImmDatas) {
-            if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+            if (this->lazyIsaUpload && kernelImmData->getIsaGraphicsAllocation() != this->exportedFunctionsSurface &&
+                this->kernelsWithIsaUploadOnLink.count(kernelImmData.get()) == 0) {
                 continue;
             }
-            kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+            this->transferKernelIsaToAllocation(neoDevice, kernelImmData, isaSegmentsForPatching);
+        }
+    }
+}
 
-            auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
-                                                                  *neoDevice,
-                                                                  kernelImmData->getIsaGraphicsAllocation(),
-                                                                  0u,
-                                                                  kernelHeapPtr,
-                                                                  kernelHeapSize);
-            kernelImmData->setIsaCopiedToAllocation();
+void ModuleImp::transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
+    if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+        return;
+    }
+    const auto &productHelper = neoDevice->getProductHelper();
+    auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
+
+    kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+
+    auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
+                                                          *neoDevice,
+                                                          kernelImmData->getIsaGraphicsAllocation(),
+                                                          0u,
+                                                          kernelHeapPtr,
+                                                          kernelHeapSize);
+    kernelImmData->setIsaCopiedToAllocation();
+}
+
+void ModuleImp::uploadKernelIsaOnFirstUse(const KernelImmutableData *kernelImmData) {
+    if (!this->lazyIsaUpload) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(this->lazyIsaUploadMutex);
+    // ISA with unresolved symbols is not patched yet, it is uploaded by the dynamic link which patches it
+    if (!this->isFullyLinked) {
+        this->kernelsWithIsaUploadOnLink.insert(kernelImmData);
+        return;
+    }
+    for (auto &ownedKernelImmData : this->kernelImmDatas) {
+        if (ownedKernelImmData.get() == kernelImmData) {
+            const auto isaSegments = this->isaSegmentsForPatching.empty() ? nullptr : &this->isaSegmentsForPatching;
+            this->transferKernelIsaToAllocation(this->device->getNEODevice(), ownedKernelImmData, isaSegments);
+            return;
         }
     }
 }
 
+size_t ModuleImp::getKernelsWithoutIsaUploadCount() const {
+    return static_cast<size_t>(std::count_if(this->kernelImmDatas.begin(), this->kernelImmDatas.end(), [](const auto &kernelImmData) {
+        return kernelImmData->getIsaGraphicsAllocation() != nullptr && !kernelImmData->isIsaCopiedToAllocation();
+    }));
+}
+
 std::pair<const void *, size_t> ModuleImp::getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData,
                                                                        const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
     if (isaSegmentsForPatching) {
@@ -966,6 +1015,9 @@ void ModuleImp::updateBuildLog(NEO::Device *neoDevice) {
 
 ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
                                     ze_kernel_handle_t *kernelHandle) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     ze_result_t res;
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
     if (!isFullyLinked) {
@@ -975,6 +1027,7 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
+        this->uploadKernelIsaOnFirstUse(kernel->getImmutableData());
         *kernelHandle = kernel->toHandle();
         if (kernel->getPrintfBufferAllocation() != nullptr) {
             this->printfKernelContainer.push_back(std::shared_ptr<Kernel>(kernel));
@@ -1009,6 +1062,9 @@ ze_result_t ModuleImp::destroyPrintfKernel(ze_kernel_handle_t kernelHandle) {
 }
 
 ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBinary) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     auto genBinary = this->translationUnit->packedDeviceBinary.get();
 
     *pSize = this->translationUnit->packedDeviceBinarySize;
@@ -1019,6 +1075,9 @@ ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBina
 }
 
 ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     if (translationUnit == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1171,6 +1230,9 @@ bool ModuleImp::linkBinary() {
 }
 
 ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnFunction) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
     // Check if the function is in the exported symbol table
     auto symbolIt = symbols.find(pFunctionName);
@@ -1182,6 +1244,7 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     if (*pfnFunction == nullptr) {
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
+            this->uploadKernelIsaOnFirstUse(kernelImmData);
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
             *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
@@ -1206,6 +1269,9 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
 }
 
 ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize, void **pPtr) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     uint64_t address;
     size_t size;
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
@@ -1243,11 +1309,31 @@ ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize,
     return ZE_RESULT_SUCCESS;
 }
 
+namespace {
+ze_result_t buildModule(ModuleImp *module, const ze_module_desc_t *desc, bool asyncBuild) {
+    auto buildStart = std::chrono::steady_clock::now();
+    auto result = module->initialize(desc, module->getDevice()->getNEODevice());
+    auto buildTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - buildStart).count();
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "Module %p built in %lld us%s, result: %d\n",
+                       module, static_cast<long long>(buildTime), asyncBuild ? " on worker thread" : "", static_cast<int>(result));
+    return result;
+}
+} // namespace
+
 Module *Module::create(Device *device, const ze_module_desc_t *desc,
                        ModuleBuildLog *moduleBuildLog, ModuleType type, ze_result_t *result) {
     auto module = new ModuleImp(device, moduleBuildLog, type);
 
-    *result = module->initialize(desc, device->getNEODevice());
+    if (ModuleImp::isAsyncBuildSupported(device, desc, moduleBuildLog, type)) {
+        auto workerPool = static_cast<DriverHandleImp *>(device->getDriverHandle())->getModuleBuildWorkerPool();
+        if (workerPool) {
+            module->initializeAsync(desc, *workerPool);
+            *result = ZE_RESULT_SUCCESS;
+            return module;
+        }
+    }
+
+    *result = buildModule(module, desc, false);
     if (*result != ZE_RESULT_SUCCESS) {
         module->destroy();
         return nullptr;
@@ -1256,7 +1342,54 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
     return module;
 }
 
+bool ModuleImp::isAsyncBuildSupported(Device *device, const ze_module_desc_t *desc, ModuleBuildLog *moduleBuildLog, ModuleType type) {
+    if (NEO::debugManager.flags.ModuleBuildWorkerThreads.get() <= 0) {
+        return false;
+    }
+    // build log is returned to the caller at creation time and debugger expects module load notification in order,
+    // program extensions and specialization constants reference caller owned memory
+    return type == ModuleType::user &&
+           moduleBuildLog == nullptr &&
+           device->getL0Debugger() == nullptr &&
+           desc->pNext == nullptr &&
+           (desc->pConstants == nullptr || desc->pConstants->numConstants == 0) &&
+           desc->pInputModule != nullptr;
+}
+
+void ModuleImp::initializeAsync(const ze_module_desc_t *desc, ModuleBuildWorkerPool &workerPool) {
+    this->asyncBuildInputs = std::make_unique<AsyncBuildInputs>();
+    auto &inputs = *this->asyncBuildInputs;
+    inputs.inputModule.assign(desc->pInputModule, desc->pInputModule + desc->inputSize);
+    inputs.desc = *desc;
+    inputs.desc.pInputModule = inputs.inputModule.data();
+    inputs.desc.pConstants = nullptr;
+    if (desc->pBuildFlags) {
+        inputs.buildFlags = desc->pBuildFlags;
+        inputs.desc.pBuildFlags = inputs.buildFlags.c_str();
+    }
+
+    this->buildPending = true;
+    workerPool.enqueue([this]() {
+        auto result = buildModule(this, &this->asyncBuildInputs->desc, true);
+
+        std::lock_guard<std::mutex> lock(this->buildMutex);
+        this->asyncBuildInputs.reset();
+        this->buildResult = result;
+        this->buildPending = false;
+        this->buildCompletion.notify_all();
+    });
+}
+
+ze_result_t ModuleImp::waitForBuildCompletion() {
+    std::unique_lock<std::mutex> lock(this->buildMutex);
+    this->buildCompletion.wait(lock, [this]() { return !this->buildPending; });
+    return this->buildResult;
+}
+
 ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     auto &kernelImmDatas = this->getKernelImmutableDataVector();
     if (*pCount == 0) {
         *pCount = static_cast<uint32_t>(kernelImmDatas.size());
@@ -1301,6 +1434,9 @@ void ModuleImp::checkIfPrivateMemoryPerDispatchIsNeeded() {
 }
 
 ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties) {
+    if (auto result = this->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     pModuleProperties->flags = 0;
 
     if (!unresolvedExternalsInfo.empty()) {
@@ -1315,6 +1451,11 @@ ze_result_t ModuleImp::inspectLinkage(
     uint32_t numModules,
     ze_module_handle_t *phModules,
     ze_module_build_log_handle_t *phLog) {
+    for (auto i = 0u; i < numModules; i++) {
+        if (auto result = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
     ModuleBuildLog *moduleLinkageLog = nullptr;
     moduleLinkageLog = ModuleBuildLog::create();
     *phLog = moduleLinkageLog->toHandle();
@@ -1385,6 +1526,11 @@ ze_result_t ModuleImp::inspectLinkage(
 ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                           ze_module_handle_t *phModules,
                                           ze_module_build_log_handle_t *phLinkLog) {
+    for (auto i = 0u; i < numModules; i++) {
+        if (auto result = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForBuildCompletion(); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
     std::map<void *, std::map<void *, void *>> dependencies;
     ModuleBuildLog *moduleLinkLog = nullptr;
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
@@ -1549,6 +1695,13 @@ bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std
 }
 
 ze_result_t ModuleImp::destroy() {
+    this->waitForBuildCompletion();
+
+    if (this->lazyIsaUpload) {
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "Module %p: ISA of %zu out of %zu kernels was never uploaded\n",
+                           this, this->getKernelsWithoutIsaUploadCount(), this->kernelImmDatas.size());
+    }
+
     notifyModuleDestroy();
 
     auto tempHandle = debugModuleHandle;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,10 +16,13 @@
 
 #include "igfxfmid.h"
 
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace NEO {
 struct KernelDescriptor;
@@ -30,6 +33,7 @@ struct Segments;
 } // namespace Zebin::Debug
 } // namespace NEO
 namespace L0 {
+class ModuleBuildWorkerPool;
 
 namespace BuildOptions {
 extern NEO::ConstStringRef optDisable;
@@ -142,6 +146,12 @@ struct ModuleImp : public Module {
     MOCKABLE_VIRTUAL bool linkBinary();
 
     ze_result_t initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    void initializeAsync(const ze_module_desc_t *desc, ModuleBuildWorkerPool &workerPool);
+    ze_result_t waitForBuildCompletion();
+    void uploadKernelIsaOnFirstUse(const KernelImmutableData *kernelImmData);
+    size_t getKernelsWithoutIsaUploadCount() const;
+    bool isLazyIsaUploadEnabled() const { return lazyIsaUpload; }
+    static bool isAsyncBuildSupported(Device *device, const ze_module_desc_t *desc, ModuleBuildLog *moduleBuildLog, ModuleType type);
 
     bool isSPIRv() { return builtFromSpirv; }
 
@@ -179,6 +189,7 @@ struct ModuleImp : public Module {
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    void transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
@@ -208,6 +219,7 @@ struct ModuleImp : public Module {
     bool isFunctionSymbolExportEnabled = false;
     bool isGlobalSymbolExportEnabled = false;
     bool precompiled = false;
+    bool lazyIsaUpload = false;
     ModuleType type;
     NEO::Linker::UnresolvedExternals unresolvedExternalsInfo{};
     std::set<NEO::GraphicsAllocation *> importedSymbolAllocations{};
@@ -219,6 +231,20 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+
+    struct AsyncBuildInputs {
+        ze_module_desc_t desc{};
+        std::vector<uint8_t> inputModule;
+        std::string buildFlags;
+    };
+    std::unique_ptr<AsyncBuildInputs> asyncBuildInputs;
+    std::mutex buildMutex;
+    std::condition_variable buildCompletion;
+    ze_result_t buildResult = ZE_RESULT_SUCCESS;
+    bool buildPending = false;
+
+    std::mutex lazyIsaUploadMutex;
+    std::set<const KernelImmutableData *> kernelsWithIsaUploadOnLink;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,10 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
     auto printfOutputSize = static_cast<uint32_t>(printfBuffer->getUnderlyingBufferSize());
     std::unique_ptr<uint8_t[]> printfOutputTemporary;
 
+    if (!useInternalBlitter && *reinterpret_cast<uint32_t *>(printfOutputBuffer) <= PrintfHandler::printfSurfaceInitialDataSize) {
+        return;
+    }
+
     if (useInternalBlitter) {
         auto selectedDevice = device->getNEODevice()->getNearestGenericSubDevice(0);
         auto &selectorCopyEngine = selectedDevice->getSelectorCopyEngine();
@@ -75,6 +79,11 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
         usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr};
     printfFormatter.printKernelOutput();
 
+    auto printfOutputSizeWritten = *reinterpret_cast<uint32_t *>(printfOutputBuffer);
+    if (printfOutputSizeWritten > printfOutputSize) {
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Printf buffer overflow, %u bytes of output were dropped.\n", printfOutputSizeWritten - printfOutputSize);
+    }
+
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
         PrintfHandler::printfSurfaceInitialDataSize;
 }
@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/kernel_helpers.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -1872,5 +1873,69 @@ HWTEST2_F(CommandListCreate, givenNewSizeDifferentThanSizesInMapWhenAllocatingPr
     neoDevice->getMemoryManager()->freeGraphicsMemory(commandList->commandContainer.getResidencyContainer()[0]);
 }
 
+HWTEST2_F(CommandListCreate, givenDevicePrivateMemoryReuseEnabledWhenCommandListIsDestroyedThenPrivateAllocationIsReusedByNextCommandList, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDevicePrivateMemoryReuse.set(1);
+
+    uint32_t sizePerHwThread = 0x1000;
+    Mock<Module> mockModule(this->device, nullptr);
+    Mock<KernelImp> mockKernel;
+    const_cast<uint32_t &>(mockKernel.kernelImmData->getDescriptor().kernelAttributes.perHwThreadPrivateMemorySize) = sizePerHwThread;
+    mockKernel.module = &mockModule;
+    auto reusedSizeBefore = device->getReusedPrivateMemorySize();
+
+    auto commandList = std::make_unique<MockCommandListCoreFamily<gfxCoreFamily>>();
+    commandList->allocateOrReuseKernelPrivateMemoryCallBase = true;
+    commandList->device = this->device;
+    commandList->allocateOrReuseKernelPrivateMemory(&mockKernel, sizePerHwThread, commandList->ownedPrivateAllocations);
+    ASSERT_EQ(1u, commandList->ownedPrivateAllocations.size());
+    auto privateAlloc = commandList->ownedPrivateAllocations[0].second;
+    EXPECT_EQ(reusedSizeBefore, device->getReusedPrivateMemorySize());
+    commandList.reset();
+
+    auto nextCommandList = std::make_unique<MockCommandListCoreFamily<gfxCoreFamily>>();
+    nextCommandList->allocateOrReuseKernelPrivateMemoryCallBase = true;
+    nextCommandList->device = this->device;
+    nextCommandList->allocateOrReuseKernelPrivateMemory(&mockKernel, sizePerHwThread, nextCommandList->ownedPrivateAllocations);
+    ASSERT_EQ(1u, nextCommandList->ownedPrivateAllocations.size());
+    EXPECT_EQ(privateAlloc, nextCommandList->ownedPrivateAllocations[0].second);
+    EXPECT_EQ(reusedSizeBefore + privateAlloc->getUnderlyingBufferSize(), device->getReusedPrivateMemorySize());
+}
+
+TEST_F(CommandListCreate, givenPrivateAllocationsForReuseWhenObtainingAllocationThenOnlyBestFitWithinTwiceRequestedSizeIsReturned) {
+    auto memoryManager = neoDevice->getMemoryManager();
+    auto smallAlloc = memoryManager->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(), MemoryConstants::pageSize64k, NEO::AllocationType::privateSurface, neoDevice->getDeviceBitfield()});
+    auto largeAlloc = memoryManager->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(), 4 * MemoryConstants::pageSize64k, NEO::AllocationType::privateSurface, neoDevice->getDeviceBitfield()});
+    device->storeReusablePrivateAllocation(*largeAlloc);
+    device->storeReusablePrivateAllocation(*smallAlloc);
+    auto reusedSizeBefore = device->getReusedPrivateMemorySize();
+
+    EXPECT_EQ(nullptr, device->obtainReusablePrivateAllocation(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(smallAlloc, device->obtainReusablePrivateAllocation(MemoryConstants::pageSize64k / 2));
+    EXPECT_EQ(nullptr, device->obtainReusablePrivateAllocation(MemoryConstants::pageSize64k));
+    EXPECT_EQ(largeAlloc, device->obtainReusablePrivateAllocation(3 * MemoryConstants::pageSize64k));
+    EXPECT_EQ(reusedSizeBefore + smallAlloc->getUnderlyingBufferSize() + largeAlloc->getUnderlyingBufferSize(), device->getReusedPrivateMemorySize());
+
+    memoryManager->freeGraphicsMemory(smallAlloc);
+    memoryManager->freeGraphicsMemory(largeAlloc);
+}
+
+TEST_F(CommandListCreate, givenFullPrivateAllocationsReusePoolWhenStoringAllocationThenOldestAllocationIsFreed) {
+    auto memoryManager = neoDevice->getMemoryManager();
+    std::vector<NEO::GraphicsAllocation *> allocations;
+    for (size_t i = 0; i <= L0::Device::maxPrivateAllocationsForReuse; i++) {
+        allocations.push_back(memoryManager->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(), MemoryConstants::pageSize64k, NEO::AllocationType::privateSurface, neoDevice->getDeviceBitfield()}));
+        device->storeReusablePrivateAllocation(*allocations.back());
+    }
+
+    for (size_t i = 0; i < L0::Device::maxPrivateAllocationsForReuse; i++) {
+        auto allocation = device->obtainReusablePrivateAllocation(MemoryConstants::pageSize64k);
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_NE(allocations[0], allocation);
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+    EXPECT_EQ(nullptr, device->obtainReusablePrivateAllocation(MemoryConstants::pageSize64k));
+}
+
 } // namespace ult
 } // namespace L0
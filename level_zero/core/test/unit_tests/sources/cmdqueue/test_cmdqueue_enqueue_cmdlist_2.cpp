@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -729,6 +729,29 @@ HWTEST2_F(CmdListPipelineSelectStateTest,
     testBodyShareStateImmediateRegular<FamilyType>();
 }
 
+HWTEST2_F(CmdListPipelineSelectStateTest,
+          givenPipelineSelectTrackingWhenExecutingSameCommandListTwiceThenPipelineSelectIsCountedAsEmittedOnceAndElidedOnce, SystolicSupport) {
+    const ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    auto result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    auto &statistics = commandQueue->csr->getStateCommandStatistics();
+    statistics.reset();
+    auto commandListHandle = commandList->toHandle();
+
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, statistics.getCounters(NEO::StateCommandType::pipelineSelect).emitted);
+    EXPECT_EQ(0u, statistics.getCounters(NEO::StateCommandType::pipelineSelect).elided);
+
+    result = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, statistics.getCounters(NEO::StateCommandType::pipelineSelect).emitted);
+    EXPECT_EQ(1u, statistics.getCounters(NEO::StateCommandType::pipelineSelect).elided);
+}
+
 using CmdListThreadArbitrationTest = Test<CmdListThreadArbitrationFixture>;
 
 using ThreadArbitrationSupport = IsProduct<IGFX_PVC>;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/hot_path_counters.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/memory_management.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
@@ -1270,6 +1271,7 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverImportExternalPointer) expectedImport = L0::zexDriverImportExternalPointer;
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
+    decltype(&zexDriverGetHotPathCounters) expectedGetHotPathCounters = L0::zexDriverGetHotPathCounters;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
     decltype(&zeIntelGetDriverVersionString) expectedIntelGetDriverVersionString = zeIntelGetDriverVersionString;
     decltype(&zeIntelMediaCommunicationCreate) expectedIntelMediaCommunicationCreate = L0::zeIntelMediaCommunicationCreate;
@@ -1293,6 +1295,9 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetHostPointerBaseAddress", &funPtr));
     EXPECT_EQ(expectedGet, reinterpret_cast<decltype(&zexDriverGetHostPointerBaseAddress)>(funPtr));
 
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetHotPathCounters", &funPtr));
+    EXPECT_EQ(expectedGetHotPathCounters, reinterpret_cast<decltype(&zexDriverGetHotPathCounters)>(funPtr));
+
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr));
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
 
@@ -1343,6 +1348,33 @@ TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenEx
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(DriverExperimentalApiTest, givenHotPathCountersWhenQueryingCountersThenCountAndNamesAndProcessWideValuesAreReturned) {
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexDriverGetHotPathCounters(driverHandle, nullptr, nullptr, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDriverGetHotPathCounters(driverHandle, &count, nullptr, nullptr));
+    EXPECT_EQ(static_cast<uint32_t>(NEO::HotPathCounters::Counter::count), count);
+
+    NEO::HotPathCounters::increment(NEO::HotPathCounters::blockingWait);
+    auto expectedBlockingWaits = NEO::HotPathCounters::get(NEO::HotPathCounters::blockingWait);
+
+    count += 1;
+    std::vector<const char *> names(count, nullptr);
+    std::vector<uint64_t> values(count, 0u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDriverGetHotPathCounters(driverHandle, &count, names.data(), values.data()));
+    EXPECT_EQ(static_cast<uint32_t>(NEO::HotPathCounters::Counter::count), count);
+    EXPECT_STREQ("flushTask", names[NEO::HotPathCounters::flushTask]);
+    EXPECT_STREQ("blockingWait", names[NEO::HotPathCounters::blockingWait]);
+    EXPECT_LE(expectedBlockingWaits, values[NEO::HotPathCounters::blockingWait]);
+    EXPECT_EQ(nullptr, names[count]);
+
+    count = 1;
+    names[1] = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDriverGetHotPathCounters(driverHandle, &count, names.data(), nullptr));
+    EXPECT_EQ(1u, count);
+    EXPECT_STREQ("flushTask", names[0]);
+    EXPECT_EQ(nullptr, names[1]);
+}
+
 TEST_F(DriverExperimentalApiTest, givenGetVersionStringAPIExistsThenGetCurrentVersionString) {
     size_t sizeOfDriverString = 0;
     auto result = zeIntelGetDriverVersionString(driverHandle, nullptr, &sizeOfDriverString);
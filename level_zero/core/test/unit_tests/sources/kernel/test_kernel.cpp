@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -3766,6 +3766,87 @@ HWTEST_F(PrintfHandlerTests, givenKernelWithPrintfWhenPrintingOutputWithBlitterU
     }
 }
 
+TEST_F(PrintfHandlerTests, givenPrintDebugMessagesAndPrintfBufferOverflowWhenPrintingOutputThenAvailableOutputIsPrintedAndOverflowIsReported) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.PrintDebugMessages.set(1);
+
+    auto device = std::unique_ptr<NEO::MockDevice>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(defaultHwInfo.get(), 0));
+    {
+        device->incRefInternal();
+        MockDeviceImp deviceImp(device.get(), device->getExecutionEnvironment());
+
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        kernelInfo->heapInfo.kernelHeapSize = 1;
+        char kernelHeap[1];
+        kernelInfo->heapInfo.pKernelHeap = &kernelHeap;
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = ZebinTestData::ValidEmptyProgram<>::kernelName;
+
+        auto kernelImmutableData = std::make_unique<KernelImmutableData>(&deviceImp);
+        kernelImmutableData->initialize(kernelInfo.get(), &deviceImp, 0, nullptr, nullptr, false);
+
+        auto &kernelDescriptor = kernelInfo->kernelDescriptor;
+        kernelDescriptor.kernelAttributes.flags.usesPrintf = true;
+        kernelDescriptor.kernelAttributes.flags.usesStringMapForPrintf = true;
+        kernelDescriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
+        kernelDescriptor.kernelAttributes.gpuPointerSize = 8u;
+        std::string expectedString("test123");
+        kernelDescriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+
+        constexpr size_t size = 8;
+        uint64_t gpuAddress = 0x2000;
+        uint32_t bufferArray[size / sizeof(uint32_t)] = {};
+        void *buffer = reinterpret_cast<void *>(bufferArray);
+        NEO::MockGraphicsAllocation mockAllocation(buffer, gpuAddress, size);
+        auto printfAllocation = reinterpret_cast<uint32_t *>(buffer);
+        printfAllocation[0] = 16;
+        printfAllocation[1] = 0;
+
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+        PrintfHandler::printOutput(kernelImmutableData.get(), &mockAllocation, &deviceImp, false);
+        std::string output = testing::internal::GetCapturedStdout();
+        std::string error = testing::internal::GetCapturedStderr();
+
+        EXPECT_STREQ(expectedString.c_str(), output.c_str());
+        EXPECT_STREQ("Printf buffer overflow, 8 bytes of output were dropped.\n", error.c_str());
+    }
+}
+
+TEST_F(PrintfHandlerTests, givenEmptyPrintfBufferWhenPrintingOutputThenNothingIsPrintedAndBufferIsNotTouched) {
+    auto device = std::unique_ptr<NEO::MockDevice>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(defaultHwInfo.get(), 0));
+    {
+        device->incRefInternal();
+        MockDeviceImp deviceImp(device.get(), device->getExecutionEnvironment());
+
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        kernelInfo->heapInfo.kernelHeapSize = 1;
+        char kernelHeap[1];
+        kernelInfo->heapInfo.pKernelHeap = &kernelHeap;
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = ZebinTestData::ValidEmptyProgram<>::kernelName;
+
+        auto kernelImmutableData = std::make_unique<KernelImmutableData>(&deviceImp);
+        kernelImmutableData->initialize(kernelInfo.get(), &deviceImp, 0, nullptr, nullptr, false);
+        kernelInfo->kernelDescriptor.kernelAttributes.flags.usesPrintf = true;
+
+        constexpr size_t size = 128;
+        uint64_t gpuAddress = 0x2000;
+        uint32_t bufferArray[size] = {};
+        void *buffer = reinterpret_cast<void *>(bufferArray);
+        NEO::MockGraphicsAllocation mockAllocation(buffer, gpuAddress, size);
+        auto printfAllocation = reinterpret_cast<uint32_t *>(buffer);
+        printfAllocation[0] = sizeof(uint32_t);
+        printfAllocation[1] = 0xdeadbeef;
+
+        testing::internal::CaptureStdout();
+        PrintfHandler::printOutput(kernelImmutableData.get(), &mockAllocation, &deviceImp, false);
+        std::string output = testing::internal::GetCapturedStdout();
+
+        EXPECT_EQ(0u, output.size());
+        EXPECT_EQ(sizeof(uint32_t), printfAllocation[0]);
+        EXPECT_EQ(0xdeadbeef, printfAllocation[1]);
+    }
+}
+
 HWTEST_F(PrintfHandlerTests, givenPrintDebugMessagesAndKernelWithPrintfWhenBlitterHangsThenErrorIsPrintedAndPrintfBufferPrinted) {
     HardwareInfo hwInfo = *defaultHwInfo;
     hwInfo.capabilityTable.blitterOperationsSupported = true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -215,6 +215,30 @@ struct ModuleKernelIsaAllocationsFixture : public ModuleFixture {
         EXPECT_EQ(result, ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY);
     }
 
+    void givenLazyKernelIsaUploadEnabledWhenKernelIsCreatedThenOnlyIsaOfThisKernelIsUploaded() {
+        debugManager.flags.EnableLazyKernelIsaUpload.set(1);
+        mockModule->computeKernelIsaAllocationAlignedSizeWithPaddingCallBase = false;
+        mockModule->computeKernelIsaAllocationAlignedSizeWithPaddingResult = isaAllocationPageSize;
+
+        auto result = module->initialize(&this->moduleDesc, device->getNEODevice());
+        EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+        EXPECT_TRUE(mockModule->isLazyIsaUploadEnabled());
+
+        auto &kernelImmDatas = module->getKernelImmutableDataVector();
+        auto kernelsWithoutIsaUpload = mockModule->getKernelsWithoutIsaUploadCount();
+        ASSERT_NE(0u, kernelsWithoutIsaUpload);
+        auto kernelImmData = std::find_if(kernelImmDatas.begin(), kernelImmDatas.end(), [](const auto &immData) { return !immData->isIsaCopiedToAllocation(); });
+        ASSERT_NE(kernelImmDatas.end(), kernelImmData);
+
+        ze_kernel_desc_t kernelDesc = {};
+        kernelDesc.pKernelName = (*kernelImmData)->getDescriptor().kernelMetadata.kernelName.c_str();
+        ze_kernel_handle_t kernelHandle = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+        EXPECT_TRUE((*kernelImmData)->isIsaCopiedToAllocation());
+        EXPECT_EQ(kernelsWithoutIsaUpload - 1, mockModule->getKernelsWithoutIsaUploadCount());
+        Kernel::fromHandle(kernelHandle)->destroy();
+    }
+
     Mock<Module> *mockModule = nullptr;
     ze_module_desc_t moduleDesc = {};
     std::unique_ptr<DebugManagerStateRestore> dbgRestorer = nullptr;
@@ -230,6 +254,10 @@ HWTEST_F(ModuleKernelIsaAllocationsInLocalMemoryTests, givenSeparateIsaMemoryReg
     this->givenSeparateIsaMemoryRegionPerKernelWhenGraphicsAllocationFailsThenProperErrorReturned();
 }
 
+HWTEST_F(ModuleKernelIsaAllocationsInLocalMemoryTests, givenLazyKernelIsaUploadEnabledWhenKernelIsCreatedThenOnlyIsaOfThisKernelIsUploaded) {
+    this->givenLazyKernelIsaUploadEnabledWhenKernelIsCreatedThenOnlyIsaOfThisKernelIsUploaded();
+}
+
 using ModuleKernelIsaAllocationsInSharedMemoryTests = Test<ModuleKernelIsaAllocationsFixture<false>>;
 
 HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenIsaMemoryRegionSharedBetweenKernelsWhenGraphicsAllocationFailsThenProperErrorReturned) {
@@ -240,6 +268,10 @@ HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenSeparateIsaMemoryRe
     this->givenSeparateIsaMemoryRegionPerKernelWhenGraphicsAllocationFailsThenProperErrorReturned();
 }
 
+HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenLazyKernelIsaUploadEnabledWhenKernelIsCreatedThenOnlyIsaOfThisKernelIsUploaded) {
+    this->givenLazyKernelIsaUploadEnabledWhenKernelIsCreatedThenOnlyIsaOfThisKernelIsUploaded();
+}
+
 HWTEST_F(ModuleTest, givenBuiltinModuleWhenCreatedThenCorrectAllocationTypeIsUsedForIsa) {
     this->module.reset();
     createModuleFromMockBinary(ModuleType::builtin);
@@ -2564,6 +2596,60 @@ TEST_F(ModuleFunctionPointerTests, givenModuleWithExportedSymbolThenGetFunctionP
     EXPECT_EQ(reinterpret_cast<uint64_t>(functionPointer), module0->kernelImmDatas[0]->getIsaGraphicsAllocation()->getGpuAddress());
 }
 
+TEST_F(ModuleDynamicLinkTests, givenLazyIsaUploadAndModuleWithUnresolvedSymbolWhenGettingKernelFunctionPointerThenPatchedIsaIsUploadedByDynamicLink) {
+    uint64_t gpuAddress = 0x12345;
+    uint32_t offset = 0x20;
+
+    NEO::Linker::RelocationInfo unresolvedRelocation;
+    unresolvedRelocation.symbolName = "unresolved";
+    unresolvedRelocation.offset = offset;
+    unresolvedRelocation.type = NEO::Linker::RelocationInfo::Type::address;
+
+    NEO::SymbolInfo symbolInfo{};
+    NEO::Linker::RelocatedSymbol<NEO::SymbolInfo> relocatedSymbol{symbolInfo, gpuAddress};
+
+    char kernelHeap[MemoryConstants::pageSize] = {};
+
+    auto kernelInfo = std::make_unique<NEO::KernelInfo>();
+    kernelInfo->heapInfo.pKernelHeap = kernelHeap;
+    kernelInfo->heapInfo.kernelHeapSize = MemoryConstants::pageSize;
+    module0->getTranslationUnit()->programInfo.kernelInfos.push_back(kernelInfo.release());
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+    module0->getTranslationUnit()->programInfo.linkerInput = std::move(linkerInput);
+    module0->unresolvedExternalsInfo.push_back({unresolvedRelocation});
+    module0->unresolvedExternalsInfo[0].instructionsSegmentId = 0u;
+    module0->lazyIsaUpload = true;
+    module0->isFullyLinked = false;
+
+    NEO::KernelDescriptor kernelDescriptor;
+    kernelDescriptor.kernelMetadata.kernelName = "kernelFunction";
+
+    auto kernelImmData = std::make_unique<WhiteBox<::L0::KernelImmutableData>>(device);
+    kernelImmData->isaGraphicsAllocation.reset(neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {device->getRootDeviceIndex(), MemoryConstants::pageSize, NEO::AllocationType::kernelIsa, neoDevice->getDeviceBitfield()}));
+    kernelImmData->kernelDescriptor = &kernelDescriptor;
+    auto isaPtr = kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer();
+    memset(isaPtr, 0xff, MemoryConstants::pageSize);
+    module0->kernelImmDatas.push_back(std::move(kernelImmData));
+
+    module1->symbols[unresolvedRelocation.symbolName] = relocatedSymbol;
+
+    void *functionPointer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->getFunctionPointer("kernelFunction", &functionPointer));
+    EXPECT_NE(nullptr, functionPointer);
+    EXPECT_FALSE(module0->kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_EQ(1u, module0->kernelsWithIsaUploadOnLink.size());
+
+    std::vector<ze_module_handle_t> hModules = {module0->toHandle(), module1->toHandle()};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->performDynamicLink(2, hModules.data(), nullptr));
+
+    EXPECT_TRUE(module0->kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_EQ(gpuAddress, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtr, offset)));
+    EXPECT_EQ(0u, *reinterpret_cast<uint64_t *>(isaPtr));
+}
+
 class DeviceModuleSetArgBufferFixture : public ModuleFixture {
   public:
     void createKernelAndAllocMemory(uint32_t rootDeviceIndex, void **ptr, ze_kernel_handle_t *kernelHandle) {
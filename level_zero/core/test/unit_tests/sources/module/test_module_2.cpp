@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/file_io.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/test_files.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -17,6 +18,7 @@
 #include "level_zero/core/source/image/image.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
+#include "level_zero/core/source/module/module_build_worker_pool.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_device.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
@@ -482,5 +484,78 @@ TEST_F(ModuleTests, givenFP64EmulationEnabledWhenCreatingModuleThenEnableFP64Gen
     EXPECT_TRUE(CompilerOptions::contains(cip->buildInternalOptions, BuildOptions::enableFP64GenEmu));
 };
 
+TEST_F(ModuleTests, givenModuleBuildWorkerThreadsSetWhenCreatingModuleThenModuleIsBuiltOnWorkerThreadFromCopyOfInputAndKernelCanBeCreated) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.ModuleBuildWorkerThreads.set(2);
+    debugManager.flags.FailBuildProgramWithStatefulAccess.set(0);
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    auto src = zebinData->storage;
+
+    ze_module_desc_t modDesc = {};
+    modDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    modDesc.inputSize = src.size();
+    modDesc.pInputModule = reinterpret_cast<const uint8_t *>(src.data());
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto module = std::unique_ptr<L0::Module>(Module::create(device, &modDesc, nullptr, ModuleType::user, &result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, module);
+    std::fill(src.begin(), src.end(), 0u);
+
+    auto workerPool = driverHandle->getModuleBuildWorkerPool();
+    ASSERT_NE(nullptr, workerPool);
+    EXPECT_EQ(2u, workerPool->getWorkersCount());
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = "memcpy_bytes_attr";
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+    ASSERT_NE(nullptr, kernelHandle);
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+TEST_F(ModuleTests, givenModuleBuildWorkerThreadsSetWhenBuildOnWorkerThreadFailsThenModuleCallsReturnBuildError) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.ModuleBuildWorkerThreads.set(1);
+
+    uint8_t invalidBinary[16] = {};
+    ze_module_desc_t modDesc = {};
+    modDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    modDesc.inputSize = sizeof(invalidBinary);
+    modDesc.pInputModule = invalidBinary;
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto module = Module::create(device, &modDesc, nullptr, ModuleType::user, &result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, module);
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = "test";
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_NE(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+    EXPECT_EQ(nullptr, kernelHandle);
+
+    uint32_t kernelsCount = 0;
+    EXPECT_NE(ZE_RESULT_SUCCESS, module->getKernelNames(&kernelsCount, nullptr));
+    module->destroy();
+}
+
+TEST_F(ModuleTests, givenModuleBuildLogRequestedWhenModuleBuildWorkerThreadsSetThenModuleIsBuiltSynchronously) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.ModuleBuildWorkerThreads.set(1);
+
+    uint8_t invalidBinary[16] = {};
+    ze_module_desc_t modDesc = {};
+    modDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    modDesc.inputSize = sizeof(invalidBinary);
+    modDesc.pInputModule = invalidBinary;
+    auto moduleBuildLog = ModuleBuildLog::create();
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto module = Module::create(device, &modDesc, moduleBuildLog, ModuleType::user, &result);
+    EXPECT_NE(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(nullptr, module);
+    EXPECT_EQ(nullptr, driverHandle->moduleBuildWorkerPool.get());
+    moduleBuildLog->destroy();
+}
+
 } // namespace ult
 } // namespace L0
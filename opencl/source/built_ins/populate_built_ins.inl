@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,7 +14,17 @@ void BuiltinDispatchInfoBuilder::populate(EBuiltInOps::Type op, ConstStringRef o
     ClDeviceVector deviceVector;
     deviceVector.push_back(&clDevice);
     prog.reset(BuiltinDispatchInfoBuilder::createProgramFromCode(src, deviceVector).release());
-    prog->build(deviceVector, options.data());
+    auto buildResult = prog->build(deviceVector, options.data());
+    if (buildResult == CL_SUCCESS && src.type != BuiltinCode::ECodeType::binary) {
+        size_t binarySize = 0;
+        if (prog->getInfo(CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr) == CL_SUCCESS && binarySize > 0) {
+            auto binary = std::make_unique<char[]>(binarySize);
+            auto binaryPtr = binary.get();
+            if (prog->getInfo(CL_PROGRAM_BINARIES, sizeof(binaryPtr), &binaryPtr, nullptr) == CL_SUCCESS) {
+                kernelsLib.getBuiltinsLib().registerCompiledBuiltin(op, clDevice.getDevice(), binary.get(), binarySize);
+            }
+        }
+    }
     grabKernels(std::forward<KernelsDescArgsT>(desc)...);
 }
 } // namespace NEO
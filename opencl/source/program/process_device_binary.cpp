@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -218,6 +218,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
 
     if (!decodedSingleDeviceBinary.isSet) {
         decodedSingleDeviceBinary.programInfo = {};
+        decodedSingleDeviceBinary.programInfo.workerPool = clDevice.getDevice().getExecutionEnvironment()->getKernelDecodeWorkerPool();
 
         auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
         SingleDeviceBinary binary = {};
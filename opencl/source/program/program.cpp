@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -201,6 +201,7 @@ cl_int Program::createProgramFromBinary(
             binary.targetDevice = NEO::getTargetDevice(clDevice.getRootDeviceEnvironment());
 
             auto &gfxCoreHelper = clDevice.getGfxCoreHelper();
+            decodedSingleDeviceBinary.programInfo.workerPool = clDevice.getDevice().getExecutionEnvironment()->getKernelDecodeWorkerPool();
             std::tie(decodedSingleDeviceBinary.decodeError, std::ignore) = NEO::decodeSingleDeviceBinary(decodedSingleDeviceBinary.programInfo,
                                                                                                          binary,
                                                                                                          decodedSingleDeviceBinary.decodeErrors,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 
 class DrmWrap : public NEO::Drm {
   public:
+    using Drm::ioctlLatencyHistograms;
     using Drm::ioctlStatistics;
     using Drm::queryDeviceIdAndRevision;
     using Drm::virtualMemoryIds;
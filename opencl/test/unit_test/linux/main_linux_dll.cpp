@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/allocator_helper.h"
 #include "shared/source/os_interface/linux/i915.h"
 #include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/ioctl_latency_histograms.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/test/common/helpers/custom_event_listener.h"
@@ -433,6 +434,45 @@ TEST_F(DrmSimpleTests, givenUseVmBindFlagWhenOverrideBindSupportThenReturnProper
     EXPECT_FALSE(useVmBind);
 }
 
+TEST_F(DrmTests, givenPrintIoctlLatencyHistogramsWhenIoctlIsInterruptedThenLatencyRetriesAndInterruptsAreRecordedAndPrintedOnDestruction) {
+    auto drm = DrmWrap::createDrm(*mockRootDeviceEnvironment);
+    ASSERT_NE(drm, nullptr);
+    EXPECT_EQ(nullptr, drm->ioctlLatencyHistograms);
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintIoctlLatencyHistograms.set(true);
+    drm = DrmWrap::createDrm(*mockRootDeviceEnvironment);
+    ASSERT_NE(drm, nullptr);
+    ASSERT_NE(nullptr, drm->ioctlLatencyHistograms);
+
+    VariableBackup<decltype(ioctlCnt)> backupIoctlCnt(&ioctlCnt);
+    VariableBackup<int> backupIoctlSeq(&ioctlSeq[0]);
+    VariableBackup<decltype(forceExtraIoctlDuration)> backupForceExtraIoctlDuration(&forceExtraIoctlDuration, true);
+
+    GetParam getParam{};
+    int lDeviceId = 0;
+    getParam.param = I915_PARAM_CHIPSET_ID;
+    getParam.value = &lDeviceId;
+    ioctlCnt = 0;
+    ioctlSeq[0] = -1;
+    errno = EINTR;
+    EXPECT_EQ(0, drm->ioctl(DrmIoctl::getparam, &getParam));
+
+    const auto &entry = drm->ioctlLatencyHistograms->getEntry(DrmIoctl::getparam);
+    EXPECT_EQ(1u, entry.count.load());
+    EXPECT_NE(0u, entry.totalTime.load());
+    EXPECT_EQ(1u, entry.retries.load());
+    EXPECT_EQ(1u, entry.interrupts.load());
+    EXPECT_EQ(0u, entry.failures.load());
+    EXPECT_NE(0u, drm->ioctlLatencyHistograms->getPercentile(DrmIoctl::getparam, 50));
+
+    ::testing::internal::CaptureStdout();
+    drm.reset();
+    auto output = ::testing::internal::GetCapturedStdout();
+    EXPECT_TRUE(hasSubstr(output, "--- Ioctl latency histograms ---"));
+    EXPECT_TRUE(hasSubstr(output, "DRM_IOCTL_I915_GETPARAM"));
+}
+
 TEST_F(DrmTests, GivenErrorCodeWhenCreatingDrmThenDrmCreatedOnlyWithSpecificErrors) {
     auto drm = DrmWrap::createDrm(*mockRootDeviceEnvironment);
     EXPECT_NE(drm, nullptr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@ class MockOclocArgHelper : public OclocArgHelper {
     bool callBaseFileExists = false;
     bool callBaseReadBinaryFile = false;
     bool callBaseLoadDataFromFile = false;
+    bool callBaseMapBinaryFile = false;
     bool callBaseReadFileToVectorOfStrings = false;
     bool shouldReturnEmptyVectorOfStrings = false;
 
@@ -45,6 +46,7 @@ class MockOclocArgHelper : public OclocArgHelper {
         callBaseFileExists = value;
         callBaseReadBinaryFile = value;
         callBaseLoadDataFromFile = value;
+        callBaseMapBinaryFile = value;
         callBaseReadFileToVectorOfStrings = value;
     }
 
@@ -71,6 +73,14 @@ class MockOclocArgHelper : public OclocArgHelper {
         return std::vector<char>(file.begin(), file.end());
     }
 
+    std::unique_ptr<NEO::MappedFile> mapBinaryFile(const std::string &filename) override {
+        if (callBaseMapBinaryFile) {
+            return OclocArgHelper::mapBinaryFile(filename);
+        }
+        const auto &file = filesMap[filename];
+        return NEO::MappedFile::createView(ArrayRef<const uint8_t>::fromAny(file.data(), file.size()));
+    }
+
   protected:
     bool fileExists(const std::string &filename) const override {
         if (callBaseFileExists) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,13 +19,17 @@ namespace NEO {
 class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
+    using MultiCommand::compilerFacadesCache;
+    using MultiCommand::jobsCount;
     using MultiCommand::lines;
+    using MultiCommand::outputFile;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
     using MultiCommand::addAdditionalOptionsToSingleCommandLine;
     using MultiCommand::initialize;
     using MultiCommand::printHelp;
+    using MultiCommand::reuseCompilerFacades;
     using MultiCommand::runBuilds;
     using MultiCommand::showResults;
     using MultiCommand::singleBuild;
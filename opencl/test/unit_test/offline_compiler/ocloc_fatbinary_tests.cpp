@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1675,7 +1675,7 @@ TEST_F(OclocFatBinaryTest, givenSpirvInputWhenFatBinaryIsRequestedThenArchiveCon
     const auto spirvSectionIt = std::find_if(elf.sectionHeaders.begin(), elf.sectionHeaders.end(), isSpirvSection);
     ASSERT_NE(elf.sectionHeaders.end(), spirvSectionIt);
 
-    ASSERT_EQ(spirvFileContent.size() + 1, spirvSectionIt->header->size);
+    ASSERT_EQ(spirvFileContent.size(), spirvSectionIt->header->size);
     const auto isSpirvDataEqualsInputFileData = std::memcmp(spirvFileContent.data(), spirvSectionIt->data.begin(), spirvFileContent.size()) == 0;
     EXPECT_TRUE(isSpirvDataEqualsInputFileData);
 }
@@ -1767,6 +1767,65 @@ TEST_F(OclocFatBinaryTest, givenBitFlagsWhenBuildingFatbinaryThenFilesInArchiveH
     }
 }
 
+TEST_F(OclocFatBinaryTest, givenJobsFlagWhenBuildingFatbinaryThenArchiveIsSameAsWithSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.insert(args.begin() + 1, {"-j", "4"});
+    buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenInvalidJobsCountWhenBuildingFatbinaryThenErrorIsReported) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    const std::array<std::string, 3> jobsToTest = {"0", "-2", "abc"};
+
+    for (const auto &jobs : jobsToTest) {
+        const std::vector<std::string> args = {
+            "ocloc",
+            "-file",
+            spirvFilename,
+            "-j",
+            jobs,
+            "-device",
+            devices};
+
+        ::testing::internal::CaptureStdout();
+        const auto result = buildFatBinary(args, &mockArgHelper);
+        const auto output{::testing::internal::GetCapturedStdout()};
+
+        EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+
+        const std::string expectedErrorMessage{"Error! Invalid number of jobs : " + jobs + "\n"};
+        EXPECT_EQ(expectedErrorMessage, output);
+    }
+}
+
 TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArchiveIsStoredInThatDirectory) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -1876,7 +1935,6 @@ TEST_F(OclocFatBinaryTest, givenEmptyFileWhenAppendingGenericIrThenInvalidFileIs
     std::string emptyFile{"empty_file.spv"};
     std::string dummyOptions{"-cl-opt-disable "};
     mockArgHelperFilesMap[emptyFile] = "";
-    mockArgHelper.shouldLoadDataFromFileReturnZeroSize = true;
 
     ::testing::internal::CaptureStdout();
     const auto errorCode{appendGenericIr(ar, emptyFile, &mockArgHelper, dummyOptions)};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/offline_compiler/source/ocloc_interface.h"
 #include "shared/offline_compiler/source/ocloc_supported_devices_helper.h"
+#include "shared/offline_compiler/source/utilities/get_current_dir.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/compiler_interface/oclc_extensions.h"
@@ -326,6 +327,89 @@ TEST_F(MultiCommandTests, GivenOutputFileListFlagWhenBuildingMultiCommandThenSuc
     delete pMultiCommand;
 }
 
+TEST_F(MultiCommandTests, GivenJobsFlagWhenBuildingMultiCommandThenResultsAreInOrderOfCommandLinesAndCompilerFacadesAreShared) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "4"};
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.argHelper = oclocArgHelperWithoutInput.get();
+    retVal = mockMultiCommand.initialize(argv);
+
+    EXPECT_EQ(OCLOC_SUCCESS, retVal);
+    EXPECT_EQ(4u, mockMultiCommand.jobsCount);
+    EXPECT_EQ(1u, mockMultiCommand.compilerFacadesCache.size());
+    ASSERT_EQ(static_cast<size_t>(numOfBuild), mockMultiCommand.retValues.size());
+
+    std::string expectedOutputFileList;
+    for (int i = 0; i < numOfBuild; i++) {
+        EXPECT_EQ(OCLOC_SUCCESS, mockMultiCommand.retValues[i]);
+        std::string outFileName = mockMultiCommand.outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+        expectedOutputFileList += getCurrentDirectoryOwn(mockMultiCommand.outDirForBuilds) + "build_no_" + std::to_string(i + 1) + ".bin\n";
+    }
+    EXPECT_EQ(expectedOutputFileList, mockMultiCommand.outputFile.str());
+
+    deleteFileWithArgs();
+}
+
+TEST(MultiCommandWhiteboxTest, GivenCompilersWithDifferentFeatureOrWorkaroundTablesWhenReusingCompilerFacadesThenFacadesAreSharedOnlyForIdenticalHardwareInfo) {
+    MockMultiCommand mockMultiCommand{};
+
+    MockOfflineCompiler firstCompiler{};
+    MockOfflineCompiler identicalCompiler{};
+    MockOfflineCompiler otherFeaturesCompiler{};
+    MockOfflineCompiler otherWorkaroundsCompiler{};
+    identicalCompiler.hwInfo = firstCompiler.hwInfo;
+    otherFeaturesCompiler.hwInfo = firstCompiler.hwInfo;
+    otherFeaturesCompiler.hwInfo.featureTable.flags.ftrLocalMemory = !firstCompiler.hwInfo.featureTable.flags.ftrLocalMemory;
+    otherWorkaroundsCompiler.hwInfo = firstCompiler.hwInfo;
+    otherWorkaroundsCompiler.hwInfo.workaroundTable.flags.waAuxTable16KGranular = !firstCompiler.hwInfo.workaroundTable.flags.waAuxTable16KGranular;
+
+    mockMultiCommand.reuseCompilerFacades(firstCompiler);
+    mockMultiCommand.reuseCompilerFacades(identicalCompiler);
+    mockMultiCommand.reuseCompilerFacades(otherFeaturesCompiler);
+    mockMultiCommand.reuseCompilerFacades(otherWorkaroundsCompiler);
+
+    EXPECT_EQ(3u, mockMultiCommand.compilerFacadesCache.size());
+    EXPECT_EQ(firstCompiler.igcFacade, identicalCompiler.igcFacade);
+    EXPECT_EQ(firstCompiler.fclFacade, identicalCompiler.fclFacade);
+    EXPECT_NE(firstCompiler.igcFacade, otherFeaturesCompiler.igcFacade);
+    EXPECT_NE(firstCompiler.igcFacade, otherWorkaroundsCompiler.igcFacade);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenInvalidJobsCountWhenInitializingThenErrorIsReturned) {
+    MockMultiCommand mockMultiCommand{};
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "0"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+    EXPECT_EQ("Error! Invalid number of jobs : 0\n", output);
+}
+
 TEST(MultiCommandWhiteboxTest, GivenVerboseModeWhenShowingResultsThenLogsArePrintedForEachBuild) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.retValues = {OCLOC_SUCCESS, OCLOC_INVALID_FILE};
@@ -4664,6 +4748,29 @@ TEST(OclocArgHelperTest, GivenOutputSuppressMessagesAndSaveItToFile) {
     delete[] lenOutputs;
 }
 
+TEST(OclocArgHelperTest, GivenInputSourceWhenMappingBinaryFileThenViewOfSourceDataIsReturnedWithoutCopy) {
+    const uint8_t input[] = {1, 2, 3, 4, 5};
+    const uint8_t *dataSources[] = {input};
+    const uint64_t lenSources[] = {sizeof(input)};
+    const char *nameSources[] = {"input.bin"};
+    uint32_t numOutputs = 0U;
+    uint64_t *lenOutputs = nullptr;
+    uint8_t **outputs = nullptr;
+    char **nameOutputs = nullptr;
+    WhiteBoxOclocArgHelper helper(1, dataSources, lenSources, nameSources,
+                                  0, nullptr, nullptr, nullptr,
+                                  &numOutputs, &outputs, &lenOutputs, &nameOutputs);
+    helper.dontSetupOutputs();
+
+    auto mappedFile = helper.mapBinaryFile("input.bin");
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_FALSE(mappedFile->isMemoryMapped());
+    EXPECT_EQ(input, mappedFile->getData().begin());
+    EXPECT_EQ(sizeof(input), mappedFile->getData().size());
+
+    EXPECT_EQ(nullptr, helper.mapBinaryFile("not/existing/file.bin"));
+}
+
 TEST(OclocArgHelperTest, GivenValidSourceFileWhenRequestingVectorOfStringsThenLinesAreStored) {
     const char input[] = "First\nSecond\nThird";
     const auto inputLength{sizeof(input)};
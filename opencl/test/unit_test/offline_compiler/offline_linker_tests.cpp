@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,11 +57,9 @@ std::string OfflineLinkerTest::getEmptyLlvmBcFile() const {
     return llvmbc;
 }
 
-MockOfflineLinker::InputFileContent OfflineLinkerTest::createFileContent(const std::string &content, IGC::CodeType::CodeType_t codeType) const {
-    std::unique_ptr<char[]> bytes{new char[content.size()]};
-    std::copy(content.begin(), content.end(), bytes.get());
-
-    return {std::move(bytes), content.size(), codeType};
+MockOfflineLinker::InputFileContent OfflineLinkerTest::createFileContent(const std::string &content, IGC::CodeType::CodeType_t codeType) {
+    const auto &storedContent = fileContents.emplace_back(content);
+    return {MappedFile::createView(ArrayRef<const uint8_t>::fromAny(storedContent.data(), storedContent.size())), codeType};
 }
 
 TEST_F(OfflineLinkerTest, GivenDefaultConstructedLinkerThenRequiredFieldsHaveDefaultValues) {
@@ -341,7 +339,6 @@ TEST_F(OfflineLinkerTest, GivenValidCommandWhenVerificationIsPerformedThenSucces
 TEST_F(OfflineLinkerTest, GivenEmptyFileWhenLoadingInputFilesThenErrorIsReturned) {
     const std::string filename{"some_file.spv"};
     mockArgHelperFilesMap[filename] = "";
-    mockArgHelper.shouldLoadDataFromFileReturnZeroSize = true;
 
     const std::vector<std::string> argv = {
         "ocloc.exe",
@@ -401,15 +398,15 @@ TEST_F(OfflineLinkerTest, GivenValidFilesWithValidFormatsWhenLoadingInputFilesTh
     const auto &firstExpectedContent = mockArgHelperFilesMap[firstFilename];
     const auto &firstActualContent = mockOfflineLinker.inputFilesContent[0];
 
-    ASSERT_EQ(firstExpectedContent.size() + 1, firstActualContent.size);
-    const auto isFirstPairEqual = std::equal(firstExpectedContent.begin(), firstExpectedContent.end(), firstActualContent.bytes.get());
+    ASSERT_EQ(firstExpectedContent.size(), firstActualContent.file->getData().size());
+    const auto isFirstPairEqual = std::equal(firstExpectedContent.begin(), firstExpectedContent.end(), firstActualContent.file->getData().begin());
     EXPECT_TRUE(isFirstPairEqual);
 
     const auto &secondExpectedContent = mockArgHelperFilesMap[secondFilename];
     const auto &secondActualContent = mockOfflineLinker.inputFilesContent[1];
 
-    ASSERT_EQ(secondExpectedContent.size() + 1, secondActualContent.size);
-    const auto isSecondPairEqual = std::equal(secondExpectedContent.begin(), secondExpectedContent.end(), secondActualContent.bytes.get());
+    ASSERT_EQ(secondExpectedContent.size(), secondActualContent.file->getData().size());
+    const auto isSecondPairEqual = std::equal(secondExpectedContent.begin(), secondExpectedContent.end(), secondActualContent.file->getData().begin());
     EXPECT_TRUE(isSecondPairEqual);
 }
 
@@ -447,8 +444,8 @@ TEST_F(OfflineLinkerTest, GivenSPIRVandLLVMBCFilesWhenElfOutputIsRequestedThenEl
     mockArgHelper.interceptOutput = true;
 
     MockOfflineLinker mockOfflineLinker{&mockArgHelper, std::move(mockOclocIgcFacade)};
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.bytes), spirvFileContent.size, spirvFileContent.codeType);
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.bytes), llvmbcFileContent.size, llvmbcFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.file), spirvFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.file), llvmbcFileContent.codeType);
     mockOfflineLinker.outputFormat = IGC::CodeType::elf;
     mockOfflineLinker.operationMode = OperationMode::linkFiles;
 
@@ -471,9 +468,9 @@ TEST_F(OfflineLinkerTest, GivenSPIRVandLLVMBCFilesWhenElfOutputIsRequestedThenEl
 
     const auto &expectedFirstSection = mockOfflineLinker.inputFilesContent[0];
     const auto &actualFirstSection = elf.sectionHeaders[1];
-    ASSERT_EQ(expectedFirstSection.size, actualFirstSection.header->size);
+    ASSERT_EQ(expectedFirstSection.file->getData().size(), actualFirstSection.header->size);
 
-    const auto isFirstSectionContentEqual = std::memcmp(actualFirstSection.data.begin(), expectedFirstSection.bytes.get(), expectedFirstSection.size) == 0;
+    const auto isFirstSectionContentEqual = std::memcmp(actualFirstSection.data.begin(), expectedFirstSection.file->getData().begin(), expectedFirstSection.file->getData().size()) == 0;
     EXPECT_TRUE(isFirstSectionContentEqual);
 
     // LLVM bitcode section.
@@ -481,9 +478,9 @@ TEST_F(OfflineLinkerTest, GivenSPIRVandLLVMBCFilesWhenElfOutputIsRequestedThenEl
 
     const auto &expectedSecondSection = mockOfflineLinker.inputFilesContent[1];
     const auto &actualSecondSection = elf.sectionHeaders[2];
-    ASSERT_EQ(expectedSecondSection.size, actualSecondSection.header->size);
+    ASSERT_EQ(expectedSecondSection.file->getData().size(), actualSecondSection.header->size);
 
-    const auto isSecondSectionContentEqual = std::memcmp(actualSecondSection.data.begin(), expectedSecondSection.bytes.get(), expectedSecondSection.size) == 0;
+    const auto isSecondSectionContentEqual = std::memcmp(actualSecondSection.data.begin(), expectedSecondSection.file->getData().begin(), expectedSecondSection.file->getData().size()) == 0;
     EXPECT_TRUE(isSecondSectionContentEqual);
 }
 
@@ -498,8 +495,8 @@ TEST_F(OfflineLinkerTest, GivenValidInputFileContentsWhenLlvmBcOutputIsRequested
     ASSERT_EQ(OCLOC_SUCCESS, igcInitializationResult);
 
     MockOfflineLinker mockOfflineLinker{&mockArgHelper, std::move(mockOclocIgcFacade)};
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.bytes), spirvFileContent.size, spirvFileContent.codeType);
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.bytes), llvmbcFileContent.size, llvmbcFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.file), spirvFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.file), llvmbcFileContent.codeType);
     mockOfflineLinker.outputFormat = IGC::CodeType::llvmBc;
     mockOfflineLinker.operationMode = OperationMode::linkFiles;
 
@@ -531,8 +528,8 @@ TEST_F(OfflineLinkerTest, GivenValidInputFileContentsAndFailingIGCWhenLlvmBcOutp
     ASSERT_EQ(OCLOC_SUCCESS, igcInitializationResult);
 
     MockOfflineLinker mockOfflineLinker{&mockArgHelper, std::move(mockOclocIgcFacade)};
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.bytes), spirvFileContent.size, spirvFileContent.codeType);
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.bytes), llvmbcFileContent.size, llvmbcFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.file), spirvFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.file), llvmbcFileContent.codeType);
     mockOfflineLinker.outputFormat = IGC::CodeType::llvmBc;
     mockOfflineLinker.operationMode = OperationMode::linkFiles;
 
@@ -562,8 +559,8 @@ TEST_F(OfflineLinkerTest, GivenValidInputFileContentsAndIGCSignalingSuccessButRe
     ASSERT_EQ(OCLOC_SUCCESS, igcInitializationResult);
 
     MockOfflineLinker mockOfflineLinker{&mockArgHelper, std::move(mockOclocIgcFacade)};
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.bytes), spirvFileContent.size, spirvFileContent.codeType);
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.bytes), llvmbcFileContent.size, llvmbcFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.file), spirvFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.file), llvmbcFileContent.codeType);
     mockOfflineLinker.outputFormat = IGC::CodeType::llvmBc;
     mockOfflineLinker.operationMode = OperationMode::linkFiles;
 
@@ -593,8 +590,8 @@ TEST_F(OfflineLinkerTest, GivenValidInputFileContentsAndInvalidTranslationOutput
     ASSERT_EQ(OCLOC_SUCCESS, igcInitializationResult);
 
     MockOfflineLinker mockOfflineLinker{&mockArgHelper, std::move(mockOclocIgcFacade)};
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.bytes), spirvFileContent.size, spirvFileContent.codeType);
-    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.bytes), llvmbcFileContent.size, llvmbcFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(spirvFileContent.file), spirvFileContent.codeType);
+    mockOfflineLinker.inputFilesContent.emplace_back(std::move(llvmbcFileContent.file), llvmbcFileContent.codeType);
     mockOfflineLinker.outputFormat = IGC::CodeType::llvmBc;
     mockOfflineLinker.operationMode = OperationMode::linkFiles;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,9 @@
 #include "mock/mock_ocloc_igc_facade.h"
 #include "mock/mock_offline_linker.h"
 
+#include <list>
+#include <string>
+
 namespace NEO {
 
 class OfflineLinkerTest : public ::testing::Test {
@@ -25,13 +28,14 @@ class OfflineLinkerTest : public ::testing::Test {
 
     std::string getEmptySpirvFile() const;
     std::string getEmptyLlvmBcFile() const;
-    MockOfflineLinker::InputFileContent createFileContent(const std::string &content, IGC::CodeType::CodeType_t codeType) const;
+    MockOfflineLinker::InputFileContent createFileContent(const std::string &content, IGC::CodeType::CodeType_t codeType);
 
   protected:
     MockOclocArgHelper::FilesMap mockArgHelperFilesMap{};
     MockOclocArgHelper mockArgHelper{mockArgHelperFilesMap};
     std::unique_ptr<MockOclocIgcFacade> mockOclocIgcFacade{};
     char binaryToReturn[8]{7, 7, 7, 7, 0, 1, 2, 3};
+    std::list<std::string> fileContents{};
 };
 
 } // namespace NEO
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -39,6 +40,7 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     explicit MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
 
     void printf(const char *message) {
+        std::lock_guard<std::mutex> lock(mtx);
         if (!suppressMessages) {
             ::printf("%s", message);
         }
@@ -47,6 +49,7 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        std::lock_guard<std::mutex> lock(mtx);
         if (!suppressMessages) {
             ::printf(format, args...);
         }
@@ -76,5 +79,6 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     }
 
     std::stringstream ss;
+    std::mutex mtx;
     bool suppressMessages = false;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,7 +13,9 @@
 #include "shared/offline_compiler/source/offline_compiler.h"
 #include "shared/offline_compiler/source/utilities/get_current_dir.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
+#include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include <memory>
 
@@ -26,6 +28,7 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     } else {
         std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
         if (retVal == OCLOC_SUCCESS) {
+            reuseCompilerFacades(*pCompiler);
             retVal = buildWithSafetyGuard(pCompiler.get());
 
             std::string &buildLog = pCompiler->getBuildLog();
@@ -35,6 +38,12 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
         }
         outFileName += ".bin";
     }
+    reportSingleBuildResult(retVal);
+
+    return retVal;
+}
+
+void MultiCommand::reportSingleBuildResult(int retVal) {
     if (retVal == OCLOC_SUCCESS) {
         if (!quiet)
             argHelper->printf("Build succeeded.\n");
@@ -48,8 +57,31 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
         outputFile << "Unsuccessful build";
     }
     outputFile << '\n';
+}
 
-    return retVal;
+void MultiCommand::reuseCompilerFacades(OfflineCompiler &compiler) {
+    // FCL and IGC contexts depend only on the target hardware, so builds for the same target share them.
+    // Key covers every part of hardware info passed to compiler contexts.
+    const auto &hwInfo = compiler.getHardwareInfo();
+    std::string key;
+    auto appendToKey = [&key](const auto &value) {
+        key.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+    appendToKey(hwInfo.platform);
+    appendToKey(hwInfo.gtSystemInfo);
+    appendToKey(hwInfo.featureTable.packed);
+    appendToKey(hwInfo.featureTable.ftrBcsInfo.to_ullong());
+    appendToKey(hwInfo.featureTable.regionCount);
+    appendToKey(hwInfo.workaroundTable.packed);
+    appendToKey(hwInfo.ipVersion.value);
+    appendToKey(hwInfo.capabilityTable.clVersionSupport);
+
+    auto cachedFacades = compilerFacadesCache.find(key);
+    if (cachedFacades == compilerFacadesCache.end()) {
+        compilerFacadesCache.emplace(key, CompilerFacades{compiler.getFclFacade(), compiler.getIgcFacade()});
+    } else {
+        compiler.setCompilerFacades(cachedFacades->second.fclFacade, cachedFacades->second.igcFacade);
+    }
 }
 
 MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &retVal, OclocArgHelper *helper) {
@@ -109,6 +141,12 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            const auto &jobsArg = args[++argIndex];
+            if (!OclocArgHelper::parseJobsCount(jobsArg, jobsCount)) {
+                argHelper->printf("Error! Invalid number of jobs : %s\n", jobsArg.c_str());
+                return OCLOC_INVALID_COMMAND_LINE;
+            }
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -128,7 +166,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
         return OCLOC_INVALID_FILE;
     }
 
-    runBuilds(args[0]);
+    if (jobsCount > 1 && lines.size() > 1) {
+        runBuildsInParallel(args[0]);
+    } else {
+        runBuilds(args[0]);
+    }
 
     if (outputFileList != "") {
         auto outputFileString = outputFile.str();
@@ -157,6 +199,79 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct BuildCommand {
+        std::vector<std::string> args;
+        std::string outDirForBuilds;
+        std::string outFileName;
+        std::unique_ptr<OfflineCompiler> compiler;
+        int retVal = OCLOC_SUCCESS;
+        bool isValid = false;
+        bool isFatBinary = false;
+    };
+    std::vector<BuildCommand> builds(lines.size());
+
+    // command lines are parsed and compilers are created one by one, as both use state shared through argHelper
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &build = builds[i];
+        build.args = {argZero};
+
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        if (build.retVal != OCLOC_SUCCESS) {
+            continue;
+        }
+        build.isValid = true;
+
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.outDirForBuilds = outDirForBuilds;
+        build.outFileName = outFileName;
+
+        build.isFatBinary = requestedFatBinary(build.args, argHelper);
+        if (!build.isFatBinary) {
+            build.compiler.reset(OfflineCompiler::create(build.args.size(), build.args, true, build.retVal, argHelper));
+            if (build.retVal == OCLOC_SUCCESS) {
+                reuseCompilerFacades(*build.compiler);
+            }
+        }
+    }
+
+    parallelFor(argHelper->getWorkerPool(), builds.size(), jobsCount, [&](size_t buildId) {
+        auto &build = builds[buildId];
+        if (build.compiler) {
+            build.retVal = buildWithSafetyGuard(build.compiler.get());
+        }
+    });
+
+    // results are reported in order of command lines; fatbinaries build their targets in parallel on their own
+    for (size_t i = 0; i < builds.size(); ++i) {
+        auto &build = builds[i];
+        if (!build.isValid) {
+            retValues.push_back(build.retVal);
+            continue;
+        }
+
+        if (!quiet) {
+            argHelper->printf("Command number %zu: \n", i + 1);
+        }
+
+        outDirForBuilds = build.outDirForBuilds;
+        outFileName = build.outFileName;
+        if (build.isFatBinary) {
+            build.retVal = singleBuild(build.args);
+        } else {
+            if (build.compiler) {
+                std::string &buildLog = build.compiler->getBuildLog();
+                if (buildLog.empty() == false) {
+                    argHelper->printf("%s\n", buildLog.c_str());
+                }
+            }
+            outFileName += ".bin";
+            reportSingleBuildResult(build.retVal);
+        }
+        retValues.push_back(build.retVal);
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -172,6 +287,10 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <count>                    Number of command lines built concurrently.
+                                Output is reported in order of command lines.
+                                Default is 1.
+
 )===");
 }
 
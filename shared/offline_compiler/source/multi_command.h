@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,13 +7,19 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class OclocArgHelper;
 
 namespace NEO {
+class OclocFclFacade;
+class OclocIgcFacade;
+class OfflineCompiler;
 
 class MultiCommand {
   public:
@@ -33,9 +39,17 @@ class MultiCommand {
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
     MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    void reportSingleBuildResult(int retVal);
+    void reuseCompilerFacades(OfflineCompiler &compiler);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsInParallel(const std::string &argZero);
+
+    struct CompilerFacades {
+        std::shared_ptr<OclocFclFacade> fclFacade;
+        std::shared_ptr<OclocIgcFacade> igcFacade;
+    };
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
@@ -43,6 +57,8 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    std::unordered_map<std::string, CompilerFacades> compilerFacadesCache;
+    uint32_t jobsCount = 1;
     bool quiet = false;
 };
 } // namespace NEO
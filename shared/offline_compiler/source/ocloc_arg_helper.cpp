@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,12 +12,16 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/worker_pool.h"
 
 #include "hw_cmds.h"
 #include "platforms.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <sstream>
 
 void Source::toVectorOfStrings(std::vector<std::string> &lines, bool replaceTabs) {
@@ -152,6 +156,14 @@ std::unique_ptr<char[]> OclocArgHelper::loadDataFromFile(const std::string &file
     }
 }
 
+std::unique_ptr<NEO::MappedFile> OclocArgHelper::mapBinaryFile(const std::string &filename) {
+    if (Source *s = findSourceFile(filename)) {
+        return NEO::MappedFile::createView(ArrayRef<const uint8_t>(s->data, s->length));
+    } else {
+        return NEO::MappedFile::map(filename);
+    }
+}
+
 uint32_t OclocArgHelper::getProductConfigAndSetHwInfoBasedOnDeviceAndRevId(NEO::HardwareInfo &hwInfo, unsigned short deviceID, int revisionID, std::unique_ptr<NEO::CompilerProductHelper> &compilerProductHelper, std::unique_ptr<NEO::ReleaseHelper> &releaseHelper) {
     const auto &deviceAotMap = productConfigHelper->getDeviceAotInfo();
 
@@ -213,3 +225,23 @@ void OclocArgHelper::saveOutput(const std::string &filename, const void *pData,
         writeDataToFile(filename.c_str(), pData, dataSize);
     }
 }
+
+bool OclocArgHelper::parseJobsCount(const std::string &jobsArg, uint32_t &jobsCount) {
+    const bool isNumber = !jobsArg.empty() && std::all_of(jobsArg.begin(), jobsArg.end(), [](unsigned char c) { return 0 != ::isdigit(c); });
+    const auto requestedJobs = isNumber ? std::strtoul(jobsArg.c_str(), nullptr, 10) : 0u;
+    if (requestedJobs < 1) {
+        return false;
+    }
+    jobsCount = static_cast<uint32_t>(std::min<unsigned long>(requestedJobs, std::numeric_limits<uint32_t>::max()));
+    return true;
+}
+
+NEO::WorkerPool *OclocArgHelper::getWorkerPool() {
+    std::lock_guard<std::mutex> lock(workerPoolMutex);
+    if (workerPool == nullptr) {
+        // threads running parallel builds and the calling thread together do not oversubscribe the CPU
+        const auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        workerPool = std::make_unique<NEO::WorkerPool>(hardwareThreads - 1);
+    }
+    return workerPool.get();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,11 +9,13 @@
 
 #include "shared/offline_compiler/source/decoder/helper.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/mapped_file.h"
 
 #include <algorithm>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -23,6 +25,7 @@ struct ProductConfigHelper;
 namespace NEO {
 class CompilerProductHelper;
 class ReleaseHelper;
+class WorkerPool;
 struct HardwareInfo;
 } // namespace NEO
 
@@ -59,7 +62,9 @@ class OclocArgHelper {
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
 
+    // may be called from parallel builds, outputs are appended only under outputsMutex
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
         outputs.push_back(std::make_unique<Output>(filename, data, size));
     }
 
@@ -83,6 +88,7 @@ class OclocArgHelper {
     MOCKABLE_VIRTUAL void readFileToVectorOfStrings(const std::string &filename, std::vector<std::string> &lines);
     MOCKABLE_VIRTUAL std::vector<char> readBinaryFile(const std::string &filename);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadDataFromFile(const std::string &filename, size_t &retSize);
+    MOCKABLE_VIRTUAL std::unique_ptr<NEO::MappedFile> mapBinaryFile(const std::string &filename);
 
     void dontSetupOutputs() { hasOutput = false; }
     bool outputEnabled() const {
@@ -104,6 +110,8 @@ class OclocArgHelper {
     }
 
     MOCKABLE_VIRTUAL void saveOutput(const std::string &filename, const void *pData, const size_t &dataSize);
+    static bool parseJobsCount(const std::string &jobsArg, uint32_t &jobsCount);
+    NEO::WorkerPool *getWorkerPool();
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
@@ -145,4 +153,9 @@ class OclocArgHelper {
     }
 
     std::unique_ptr<ProductConfigHelper> productConfigHelper;
+
+  private:
+    std::mutex outputsMutex;
+    std::unique_ptr<NEO::WorkerPool> workerPool;
+    std::mutex workerPoolMutex;
 };
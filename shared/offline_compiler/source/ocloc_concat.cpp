@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -103,8 +103,12 @@ AOT::PRODUCT_CONFIG OclocConcat::getAOTProductConfigFromBinary(ArrayRef<const ui
 OclocConcat::ErrorCode OclocConcat::concatenate() {
     NEO::Ar::ArEncoder arEncoder(true);
     for (auto &fileName : fileNamesToConcat) {
-        auto file = argHelper->readBinaryFile(fileName);
-        auto fileRef = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(file.data()), file.size());
+        auto file = argHelper->mapBinaryFile(fileName);
+        if (nullptr == file) {
+            printMsg(fileName, "Couldn't read file.\n");
+            return OCLOC_INVALID_FILE;
+        }
+        auto fileRef = file->getData();
 
         if (NEO::Ar::isAr(fileRef)) {
             std::string warnings;
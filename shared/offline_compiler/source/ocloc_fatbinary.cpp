@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/product_config_helper.h"
 #include "shared/source/utilities/directory.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "igfxfmid.h"
 #include "platforms.h"
@@ -283,27 +284,30 @@ int getDeviceArgValueIdx(const std::vector<std::string> &args) {
 
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
-
-    if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
-    }
     if (retVal) {
         return retVal;
     }
+    retVal = buildWithSafetyGuard(pCompiler);
+    return appendTargetToFatBinary(retVal, argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
+}
+
+int appendTargetToFatBinary(int buildRetVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
+    }
+    if (buildRetVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), buildRetVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+        return buildRetVal;
+    }
 
     std::string entryName("");
     if (product.find(".") != std::string::npos) {
@@ -321,7 +325,44 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + entryName, pCompiler->getPackedDeviceBinaryOutput());
-    return retVal;
+    return OCLOC_SUCCESS;
+}
+
+int buildFatBinaryTargetsInParallel(const std::vector<ConstStringRef> &targetProducts, uint32_t jobsCount, std::vector<std::string> &argsCopy, size_t deviceArgIndex,
+                                    std::string pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr) {
+    // compilers are created one by one, as their initialization updates state shared through argHelper
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers;
+    std::vector<std::vector<std::string>> targetsArgs;
+    compilers.reserve(targetProducts.size());
+    targetsArgs.reserve(targetProducts.size());
+    for (const auto &product : targetProducts) {
+        int retVal = 0;
+        argsCopy[deviceArgIndex] = product.str();
+
+        compilers.emplace_back(OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper));
+        if (OCLOC_SUCCESS != retVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return retVal;
+        }
+        targetsArgs.push_back(argsCopy);
+    }
+
+    std::vector<int> buildResults(targetProducts.size(), OCLOC_SUCCESS);
+    parallelFor(argHelper->getWorkerPool(), targetProducts.size(), jobsCount, [&](size_t targetId) {
+        buildResults[targetId] = buildWithSafetyGuard(compilers[targetId].get());
+    });
+
+    // results are reported and appended in order of targets, so the fatbinary does not depend on build timings
+    for (size_t targetId = 0; targetId < targetProducts.size(); targetId++) {
+        const auto retVal = appendTargetToFatBinary(buildResults[targetId], targetsArgs[targetId], pointerSize, fatbinary, compilers[targetId].get(), argHelper, targetProducts[targetId].str());
+        if (retVal) {
+            return retVal;
+        }
+        if (optionsForIr.empty()) {
+            optionsForIr = compilers[targetId]->getOptions();
+        }
+    }
+    return OCLOC_SUCCESS;
 }
 
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
@@ -333,6 +374,8 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     bool spirvInput = false;
     bool excludeIr = false;
     std::set<std::string> deviceAcronymsFromDeviceOptions;
+    size_t jobsArgIndex = -1;
+    uint32_t jobsCount = 1;
 
     std::vector<std::string> argsCopy(args);
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
@@ -342,6 +385,9 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            jobsArgIndex = argIndex;
+            ++argIndex;
         } else if ((CompilerOptions::arch32bit == currArg) || (ConstStringRef("-32") == currArg)) {
             pointerSizeInBits = "32";
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
@@ -378,6 +424,20 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         return OCLOC_INVALID_COMMAND_LINE;
     }
 
+    if (jobsArgIndex != static_cast<size_t>(-1)) {
+        const auto &jobsArg = args[jobsArgIndex + 1];
+        if (!OclocArgHelper::parseJobsCount(jobsArg, jobsCount)) {
+            argHelper->printf("Error! Invalid number of jobs : %s\n", jobsArg.c_str());
+            return OCLOC_INVALID_COMMAND_LINE;
+        }
+
+        // -j is handled here only, so it is not passed to per target compilers
+        argsCopy.erase(argsCopy.begin() + jobsArgIndex, argsCopy.begin() + jobsArgIndex + 2);
+        if (deviceArgIndex > jobsArgIndex) {
+            deviceArgIndex -= 2;
+        }
+    }
+
     Ar::ArEncoder fatbinary(true);
     std::vector<ConstStringRef> targetProducts;
     targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
@@ -392,22 +452,29 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OCLOC_SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
-        }
-
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+    if (jobsCount > 1 && targetProducts.size() > 1) {
+        const auto retVal = buildFatBinaryTargetsInParallel(targetProducts, jobsCount, argsCopy, deviceArgIndex, pointerSizeInBits, fatbinary, argHelper, optionsForIr);
         if (retVal) {
             return retVal;
         }
-        if (optionsForIr.empty()) {
-            optionsForIr = pCompiler->getOptions();
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OCLOC_SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
+            if (optionsForIr.empty()) {
+                optionsForIr = pCompiler->getOptions();
+            }
         }
     }
 
@@ -442,14 +509,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
 }
 
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper, std::string options) {
-    std::size_t fileSize = 0;
-    std::unique_ptr<char[]> fileContents = argHelper->loadDataFromFile(inputFile, fileSize);
-    if (fileSize == 0) {
+    auto file = argHelper->mapBinaryFile(inputFile);
+    if (!file || file->getData().empty()) {
         argHelper->printf("Error! Couldn't read input file!\n");
         return OCLOC_INVALID_FILE;
     }
 
-    const auto ir = ArrayRef<const uint8_t>::fromAny(fileContents.get(), fileSize);
+    const auto ir = file->getData();
     const auto opt = ArrayRef<const uint8_t>::fromAny(options.data(), options.size());
     if (!isSpirVBitcode(ir)) {
         argHelper->printf("Error! Input file is not in supported generic IR format! "
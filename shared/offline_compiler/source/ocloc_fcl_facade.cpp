@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@ OclocFclFacade::OclocFclFacade(OclocArgHelper *argHelper)
 OclocFclFacade::~OclocFclFacade() = default;
 
 int OclocFclFacade::initialize(const HardwareInfo &hwInfo) {
+    std::lock_guard<std::mutex> lock(initializationMutex);
     if (initialized) {
         return OCLOC_SUCCESS;
     }
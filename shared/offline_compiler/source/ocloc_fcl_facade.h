@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include "ocl_igc_interface/fcl_ocl_device_ctx.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 class OclocArgHelper;
@@ -56,6 +57,7 @@ class OclocFclFacade {
     std::unique_ptr<OsLibrary> fclLib;
     CIF::RAII::UPtr_t<CIF::CIFMain> fclMain;
     CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL> fclDeviceCtx;
+    std::mutex initializationMutex;
     bool initialized{false};
 };
 
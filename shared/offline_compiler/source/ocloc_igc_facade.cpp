@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@ OclocIgcFacade::OclocIgcFacade(OclocArgHelper *argHelper)
 OclocIgcFacade::~OclocIgcFacade() = default;
 
 int OclocIgcFacade::initialize(const HardwareInfo &hwInfo) {
+    std::lock_guard<std::mutex> lock(initializationMutex);
     if (initialized) {
         return OCLOC_SUCCESS;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 class OclocArgHelper;
@@ -63,6 +64,7 @@ class OclocIgcFacade {
     time_t igcLibMTime{0};
     CIF::RAII::UPtr_t<CIF::CIFMain> igcMain;
     CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL> igcDeviceCtx;
+    std::mutex initializationMutex;
     bool initialized{false};
 };
 
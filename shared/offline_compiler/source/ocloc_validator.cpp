@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,10 +51,15 @@ int validate(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
         return -1;
     }
 
-    auto fileData = argHelper->readBinaryFile(fileName);
-    argHelper->printf("Validating : %s (%zd bytes).\n", fileName.c_str(), fileData.size());
+    auto fileData = argHelper->mapBinaryFile(fileName);
+    if (nullptr == fileData) {
+        argHelper->printf("Error : Could not read input file : %s\n", fileName.c_str());
+        return -1;
+    }
+
+    auto deviceBinary = fileData->getData();
+    argHelper->printf("Validating : %s (%zd bytes).\n", fileName.c_str(), deviceBinary.size());
 
-    auto deviceBinary = ArrayRef<const uint8_t>::fromAny(fileData.data(), fileData.size());
     if (false == NEO::isDeviceBinaryFormat<DeviceBinaryFormat::zebin>(deviceBinary)) {
         argHelper->printf("Input is not a Zebin file (not elf or wrong elf object file type)\n");
         return -2;
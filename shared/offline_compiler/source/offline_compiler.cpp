@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1272,6 +1272,9 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
                                             will compile for each of these targets and will
                                             create a fatbinary archive that contains all of
                                             device binaries produced this way.
+                                            Such targets can be built concurrently with
+                                            -j <count> (default is 1). Order of entries in
+                                            the fatbinary archive does not depend on it.
                                             Supported -device patterns examples:
                                             -device 0x4905        ; will compile 1 target (dg1)
                                             -device 12.10.0       ; will compile 1 target (dg1)
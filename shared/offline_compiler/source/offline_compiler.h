@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -148,6 +148,19 @@ All supported acronyms: %s.
         return options;
     }
 
+    std::shared_ptr<OclocFclFacade> getFclFacade() const {
+        return fclFacade;
+    }
+
+    std::shared_ptr<OclocIgcFacade> getIgcFacade() const {
+        return igcFacade;
+    }
+
+    void setCompilerFacades(std::shared_ptr<OclocFclFacade> fclFacade, std::shared_ptr<OclocIgcFacade> igcFacade) {
+        this->fclFacade = std::move(fclFacade);
+        this->igcFacade = std::move(igcFacade);
+    }
+
   protected:
     OfflineCompiler();
 
@@ -233,8 +246,8 @@ All supported acronyms: %s.
     int revisionId = -1;
     uint64_t hwInfoConfig = 0u;
 
-    std::unique_ptr<OclocIgcFacade> igcFacade;
-    std::unique_ptr<OclocFclFacade> fclFacade;
+    std::shared_ptr<OclocIgcFacade> igcFacade;
+    std::shared_ptr<OclocFclFacade> fclFacade;
     std::unique_ptr<CompilerCache> cache;
     std::unique_ptr<CompilerProductHelper> compilerProductHelper;
     std::unique_ptr<ReleaseHelper> releaseHelper;
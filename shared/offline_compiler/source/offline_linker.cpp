@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -156,39 +156,34 @@ int OfflineLinker::verifyLinkerCommand() {
 }
 
 int OfflineLinker::loadInputFilesContent() {
-    std::unique_ptr<char[]> bytes{};
-    size_t size{};
-    IGC::CodeType::CodeType_t codeType{};
-
     inputFilesContent.reserve(inputFilenames.size());
 
     for (const auto &filename : inputFilenames) {
-        size = 0;
-        bytes = argHelper->loadDataFromFile(filename, size);
-        if (size == 0) {
+        // files are mapped, their content is copied only once into the linker input ELF
+        auto file = argHelper->mapBinaryFile(filename);
+        if (!file || file->getData().empty()) {
             argHelper->printf("Error: Cannot read input file: %s\n", filename.c_str());
             return OCLOC_INVALID_FILE;
         }
 
-        codeType = detectCodeType(bytes.get(), size);
+        const auto codeType = detectCodeType(file->getData());
         if (codeType == IGC::CodeType::invalid) {
             argHelper->printf("Error: Unsupported format of input file: %s\n", filename.c_str());
             return OCLOC_INVALID_PROGRAM;
         }
 
-        inputFilesContent.emplace_back(std::move(bytes), size, codeType);
+        inputFilesContent.emplace_back(std::move(file), codeType);
     }
 
     return OCLOC_SUCCESS;
 }
 
-IGC::CodeType::CodeType_t OfflineLinker::detectCodeType(char *bytes, size_t size) const {
-    const auto bytesArray = ArrayRef<const uint8_t>::fromAny(bytes, size);
-    if (isSpirVBitcode(bytesArray)) {
+IGC::CodeType::CodeType_t OfflineLinker::detectCodeType(ArrayRef<const uint8_t> bytes) const {
+    if (isSpirVBitcode(bytes)) {
         return IGC::CodeType::spirV;
     }
 
-    if (isLlvmBitcode(bytesArray)) {
+    if (isLlvmBitcode(bytes)) {
         return IGC::CodeType::llvmBc;
     }
 
@@ -296,13 +291,12 @@ std::vector<uint8_t> OfflineLinker::createSingleInputFile() const {
     NEO::Elf::ElfEncoder<> elfEncoder{true, false, 1U};
     elfEncoder.getElfFileHeader().type = Elf::ET_OPENCL_OBJECTS;
 
-    for (const auto &[bytes, size, codeType] : inputFilesContent) {
+    for (const auto &[file, codeType] : inputFilesContent) {
         const auto isSpirv = codeType == IGC::CodeType::spirV;
         const auto sectionType = isSpirv ? Elf::SHT_OPENCL_SPIRV : Elf::SHT_OPENCL_LLVM_BINARY;
         const auto sectionName = isSpirv ? Elf::SectionNamesOpenCl::spirvObject : Elf::SectionNamesOpenCl::llvmObject;
-        const auto bytesArray = ArrayRef<const uint8_t>::fromAny(bytes.get(), size);
 
-        elfEncoder.appendSection(sectionType, sectionName, bytesArray);
+        elfEncoder.appendSection(sectionType, sectionName, file->getData());
     }
 
     return elfEncoder.encode();
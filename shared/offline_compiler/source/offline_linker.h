@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/mapped_file.h"
 
 #include "ocl_igc_interface/code_type.h"
 
@@ -34,11 +35,10 @@ class OfflineLinker {
     };
 
     struct InputFileContent {
-        InputFileContent(std::unique_ptr<char[]> bytes, size_t size, IGC::CodeType::CodeType_t codeType)
-            : bytes{std::move(bytes)}, size{size}, codeType{codeType} {}
+        InputFileContent(std::unique_ptr<MappedFile> file, IGC::CodeType::CodeType_t codeType)
+            : file{std::move(file)}, codeType{codeType} {}
 
-        std::unique_ptr<char[]> bytes{};
-        size_t size{};
+        std::unique_ptr<MappedFile> file{};
         IGC::CodeType::CodeType_t codeType{};
     };
 
@@ -56,7 +56,7 @@ class OfflineLinker {
     IGC::CodeType::CodeType_t parseOutputFormat(const std::string &outputFormatName);
     int verifyLinkerCommand();
     int loadInputFilesContent();
-    IGC::CodeType::CodeType_t detectCodeType(char *bytes, size_t size) const;
+    IGC::CodeType::CodeType_t detectCodeType(ArrayRef<const uint8_t> bytes) const;
     int initHardwareInfo();
     int link();
     int showHelp();
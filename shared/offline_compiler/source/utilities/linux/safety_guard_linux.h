@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,7 +14,8 @@
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+// per thread, so targets may be built under separate guards concurrently
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardLinux {
   public:
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -124,10 +124,26 @@ class EmbeddedStorage : public Storage {
     BuiltinResourceT loadImpl(const std::string &fullResourceName) override;
 };
 
+// Device binaries of built-ins which were built at runtime from intermediate code.
+// Shared by all root devices of an execution environment, so each built-in is built once per hardware configuration.
+class CompiledBuiltinsCache {
+  public:
+    static std::string getKey(EBuiltInOps::Type builtin, const Device &device);
+
+    void store(const std::string &key, const char *binary, size_t binarySize);
+    BuiltinResourceT load(const std::string &key) const;
+    size_t getEntriesCount() const;
+
+  protected:
+    std::unordered_map<std::string, BuiltinResourceT> binaries;
+    mutable std::mutex mtx;
+};
+
 class BuiltinsLib {
   public:
     BuiltinsLib();
     BuiltinCode getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
+    void registerCompiledBuiltin(EBuiltInOps::Type builtin, Device &device, const char *binary, size_t binarySize);
 
   protected:
     BuiltinResourceT getBuiltinResource(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
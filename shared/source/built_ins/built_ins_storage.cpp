@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,11 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/path.h"
 
@@ -18,6 +20,7 @@
 
 #include <cstdint>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 
 namespace NEO {
@@ -220,7 +223,55 @@ BuiltinResourceT BuiltinsLib::getBuiltinResource(EBuiltInOps::Type builtin, Buil
             }
         }
     }
+
+    auto compiledBuiltinsCache = device.getExecutionEnvironment()->compiledBuiltinsCache.get();
+    if (requestedCodeType == BuiltinCode::ECodeType::binary && compiledBuiltinsCache) {
+        builtinResource = compiledBuiltinsCache->load(CompiledBuiltinsCache::getKey(builtin, device));
+    }
     return builtinResource;
 }
 
+void BuiltinsLib::registerCompiledBuiltin(EBuiltInOps::Type builtin, Device &device, const char *binary, size_t binarySize) {
+    auto compiledBuiltinsCache = device.getExecutionEnvironment()->compiledBuiltinsCache.get();
+    if (compiledBuiltinsCache == nullptr || binary == nullptr || binarySize == 0) {
+        return;
+    }
+    compiledBuiltinsCache->store(CompiledBuiltinsCache::getKey(builtin, device), binary, binarySize);
+}
+
+std::string CompiledBuiltinsCache::getKey(EBuiltInOps::Type builtin, const Device &device) {
+    auto &hwInfo = device.getHardwareInfo();
+    auto resourceNames = getBuiltinResourceNames(builtin, BuiltinCode::ECodeType::binary, device);
+
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
+    const auto featureTableHash = hwInfo.featureTable.asHash();
+    hash.update(reinterpret_cast<const char *>(&featureTableHash), sizeof(featureTableHash));
+    const auto workaroundTableHash = hwInfo.workaroundTable.asHash();
+    hash.update(reinterpret_cast<const char *>(&workaroundTableHash), sizeof(workaroundTableHash));
+
+    std::ostringstream key;
+    key << resourceNames[0] << "_" << std::setfill('0') << std::setw(16) << std::hex << hash.finish();
+    return key.str();
+}
+
+void CompiledBuiltinsCache::store(const std::string &key, const char *binary, size_t binarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    binaries.emplace(key, createBuiltinResource(binary, binarySize));
+}
+
+BuiltinResourceT CompiledBuiltinsCache::load(const std::string &key) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = binaries.find(key);
+    if (it == binaries.end()) {
+        return BuiltinResourceT{};
+    }
+    return createBuiltinResource(it->second);
+}
+
+size_t CompiledBuiltinsCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return binaries.size();
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/hot_path_counters.h"
 namespace NEO {
 
 CommandContainer::~CommandContainer() {
@@ -342,6 +343,7 @@ GraphicsAllocation *CommandContainer::obtainNextCommandBufferAllocation(bool for
 }
 
 void CommandContainer::allocateNextCommandBuffer() {
+    HotPathCounters::increment(HotPathCounters::commandBufferAllocation);
     auto cmdBufferAllocation = this->obtainNextCommandBufferAllocation();
     UNRECOVERABLE_IF(!cmdBufferAllocation);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/hot_path_counters.h"
 #include "shared/source/utilities/hw_timestamps.h"
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/tag_allocator.h"
@@ -104,6 +105,10 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    if (debugManager.flags.PrintStateCommandStatistics.get() && this->osContext) {
+        this->stateCommandStatistics.print(this->osContext->getContextId());
+    }
+
     if (userPauseConfirmation) {
         {
             std::unique_lock<SpinLock> lock{debugPauseStateLock};
@@ -238,7 +243,11 @@ WaitStatus CommandStreamReceiver::waitForTaskCountAndCleanAllocationList(TaskCou
 }
 
 WaitStatus CommandStreamReceiver::waitForTaskCountAndCleanTemporaryAllocationList(TaskCountType requiredTaskCount) {
-    return waitForTaskCountAndCleanAllocationList(requiredTaskCount, TEMPORARY_ALLOCATION);
+    auto waitStatus = waitForTaskCountAndCleanAllocationList(requiredTaskCount, TEMPORARY_ALLOCATION);
+    if (waitStatus == WaitStatus::ready && releaseScratchSpaceIfIdle()) {
+        internalAllocationStorage->cleanAllocationList(requiredTaskCount, TEMPORARY_ALLOCATION);
+    }
+    return waitStatus;
 }
 
 void CommandStreamReceiver::ensureCommandBufferAllocation(LinearStream &commandStream, size_t minimumRequiredSize, size_t additionalAllocationSize) {
@@ -338,6 +347,12 @@ bool CommandStreamReceiver::initializeResources(bool allocateInterrupt) {
             if (!osContext->ensureContextInitialized(allocateInterrupt)) {
                 return false;
             }
+            if (primaryCsr && primaryCsr->isEngineResourcesCreationDeferred() && !primaryCsr->initializeResources(false)) {
+                return false;
+            }
+            if (this->engineResourcesCreationDeferred && !this->createEngineResources()) {
+                return false;
+            }
             this->fillReusableAllocationsList();
             this->resourcesInitialized = true;
         }
@@ -486,6 +501,7 @@ bool CommandStreamReceiver::checkGpuHangDetected(TimeType currentTime, TimeType
 }
 
 WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *pollAddress, const WaitParams &params, TaskCountType taskCountToWait) {
+    HotPathCounters::increment(HotPathCounters::blockingWait);
     std::chrono::high_resolution_clock::time_point waitStartTime, lastHangCheckTime, currentTime;
     int64_t timeDiff = 0;
 
@@ -575,6 +591,9 @@ FlushStamp CommandStreamReceiver::obtainCurrentFlushStamp() const {
 }
 
 void CommandStreamReceiver::setRequiredScratchSizes(uint32_t newRequiredScratchSlot0Size, uint32_t newRequiredScratchSlot1Size) {
+    if (newRequiredScratchSlot0Size > 0 || newRequiredScratchSlot1Size > 0) {
+        markScratchSpaceUsed();
+    }
     if (newRequiredScratchSlot0Size > requiredScratchSlot0Size) {
         requiredScratchSlot0Size = newRequiredScratchSlot0Size;
     }
@@ -583,6 +602,32 @@ void CommandStreamReceiver::setRequiredScratchSizes(uint32_t newRequiredScratchS
     }
 }
 
+bool CommandStreamReceiver::releaseScratchSpaceIfIdle() {
+    auto idleTimeout = debugManager.flags.ScratchSpaceIdleReleaseTimeoutInMilliseconds.get();
+    // scratch is released per engine; engines share the primary CSR scratch only in heapless mode,
+    // which is excluded because scratch addresses are patched into recorded commands there
+    if (idleTimeout < 0 || this->heaplessModeEnabled) {
+        return false;
+    }
+    auto lock = obtainUniqueOwnership();
+    if (scratchSpaceController->getScratchSpaceSlot0Allocation() == nullptr && scratchSpaceController->getScratchSpaceSlot1Allocation() == nullptr) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() - lastScratchSpaceUsageTime < std::chrono::milliseconds(idleTimeout)) {
+        return false;
+    }
+    if (!isLatestTaskCountFlushed() || isBusy()) {
+        return false;
+    }
+
+    scratchSpaceController->releaseScratchSpace();
+    requiredScratchSlot0Size = 0;
+    requiredScratchSlot1Size = 0;
+    setMediaVFEStateDirty(true);
+    setGSBAStateDirty(true);
+    return true;
+}
+
 GraphicsAllocation *CommandStreamReceiver::getScratchAllocation() {
     return scratchSpaceController->getScratchSpaceSlot0Allocation();
 }
@@ -914,6 +959,16 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
     return this->preemptionAllocation != nullptr;
 }
 
+bool CommandStreamReceiver::createEngineResources() {
+    if (!createGlobalFenceAllocation()) {
+        return false;
+    }
+    if (osContext->getPreemptionMode() == PreemptionMode::MidThread && !createPreemptionAllocation()) {
+        return false;
+    }
+    return true;
+}
+
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/command_stream/state_command_statistics.h"
 #include "shared/source/command_stream/stream_properties.h"
 #include "shared/source/gmm_helper/cache_settings_helper.h"
 #include "shared/source/helpers/blit_properties_container.h"
@@ -197,6 +198,10 @@ class CommandStreamReceiver {
     bool isRayTracingStateProgramingNeeded(Device &device) const;
 
     void setRequiredScratchSizes(uint32_t newRequiredScratchSlot0Size, uint32_t newRequiredPrivateScratchSlot1Size);
+    void markScratchSpaceUsed() {
+        lastScratchSpaceUsageTime = std::chrono::steady_clock::now();
+    }
+    bool releaseScratchSpaceIfIdle();
     GraphicsAllocation *getScratchAllocation();
     GraphicsAllocation *getDebugSurfaceAllocation() const {
         if (primaryCsr) {
@@ -263,6 +268,9 @@ class CommandStreamReceiver {
     MOCKABLE_VIRTUAL bool createWorkPartitionAllocation(const Device &device);
     MOCKABLE_VIRTUAL bool createGlobalFenceAllocation();
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
+    bool createEngineResources();
+    void deferEngineResourcesCreation() { engineResourcesCreationDeferred = true; }
+    bool isEngineResourcesCreationDeferred() const { return engineResourcesCreationDeferred; }
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
@@ -409,6 +417,10 @@ class CommandStreamReceiver {
         return this->streamProperties;
     }
 
+    StateCommandStatistics &getStateCommandStatistics() {
+        return this->stateCommandStatistics;
+    }
+
     inline void setActivePartitions(uint32_t newPartitionCount) {
         activePartitions = newPartitionCount;
     }
@@ -606,6 +618,7 @@ class CommandStreamReceiver {
 
     LinearStream commandStream;
     StreamProperties streamProperties{};
+    StateCommandStatistics stateCommandStatistics{};
     FrontEndPropertiesSupport feSupportFlags{};
     PipelineSelectPropertiesSupport pipelineSupportFlags{};
     StateBaseAddressPropertiesSupport sbaSupportFlags{};
@@ -652,6 +665,7 @@ class CommandStreamReceiver {
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
 
     std::chrono::microseconds gpuHangCheckPeriod{500'000};
+    std::chrono::steady_clock::time_point lastScratchSpaceUsageTime{};
     uint32_t lastSentL3Config = 0;
     uint32_t latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     uint64_t lastSentSliceCount = QueueSliceCount::defaultSliceCount;
@@ -700,7 +714,8 @@ class CommandStreamReceiver {
     bool useNotifyEnableForPostSync = false;
     bool dcFlushSupport = false;
     bool forceSkipResourceCleanupRequired = false;
-    bool resourcesInitialized = false;
+    std::atomic<bool> resourcesInitialized{false};
+    bool engineResourcesCreationDeferred = false;
     bool heaplessStateInitialized = false;
     bool doubleSbaWa = false;
     bool dshSupported = false;
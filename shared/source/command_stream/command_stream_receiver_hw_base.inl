@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/hot_path_counters.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "command_stream_receiver_hw_ext.inl"
@@ -295,6 +296,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushImmediateTask(
     size_t immediateCommandStreamStart,
     ImmediateDispatchFlags &dispatchFlags,
     Device &device) {
+    HotPathCounters::increment(HotPathCounters::flushImmediateTask);
 
     ImmediateFlushData flushData;
     flushData.pipelineSelectFullConfigurationNeeded = !getPreambleSetFlag();
@@ -386,6 +388,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     TaskCountType taskLevel,
     DispatchFlags &dispatchFlags,
     Device &device) {
+    HotPathCounters::increment(HotPathCounters::flushTask);
 
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
@@ -580,7 +583,9 @@ void CommandStreamReceiverHw<GfxFamily>::forcePipeControl(NEO::LinearStream &com
 
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::programComputeMode(LinearStream &stream, DispatchFlags &dispatchFlags, const HardwareInfo &hwInfo) {
-    if (this->streamProperties.stateComputeMode.isDirty()) {
+    bool stateComputeModeDirty = this->streamProperties.stateComputeMode.isDirty();
+    this->stateCommandStatistics.record(StateCommandType::stateComputeMode, stateComputeModeDirty);
+    if (stateComputeModeDirty) {
         EncodeComputeMode<GfxFamily>::programComputeModeCommandWithSynchronization(
             stream, this->streamProperties.stateComputeMode, dispatchFlags.pipelineSelectArgs,
             hasSharedHandles(), this->peekRootDeviceEnvironment(), isRcs(), this->dcFlushSupport);
@@ -871,6 +876,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::programPreamble(LinearStream &cs
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programVFEState(LinearStream &csr, DispatchFlags &dispatchFlags, uint32_t maxFrontEndThreads) {
+    this->stateCommandStatistics.record(StateCommandType::frontEnd, mediaVfeStateDirty);
     if (mediaVfeStateDirty) {
         if (dispatchFlags.additionalKernelExecInfo != AdditionalKernelExecInfo::notApplicable) {
             lastAdditionalKernelExecInfo = dispatchFlags.additionalKernelExecInfo;
@@ -1622,6 +1628,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::programStateBaseAddress(const In
     stateBaseAddressDirty |= ((gsbaFor32BitProgrammed ^ dispatchFlags.gsba32BitRequired) && force32BitAllocations);
     bool isStateBaseAddressDirty = dshDirty || iohDirty || sshDirty || stateBaseAddressDirty;
     handleStateBaseAddressStateTransition(dispatchFlags, isStateBaseAddressDirty);
+    this->stateCommandStatistics.record(StateCommandType::stateBaseAddress, isStateBaseAddressDirty);
 
     // reprogram state base address command if required
     if (isStateBaseAddressDirty) {
@@ -1944,6 +1951,7 @@ void CommandStreamReceiverHw<GfxFamily>::handleImmediateFlushPipelineSelectState
 
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::dispatchImmediateFlushPipelineSelectCommand(ImmediateFlushData &flushData, LinearStream &csrStream) {
+    this->stateCommandStatistics.record(StateCommandType::pipelineSelect, flushData.pipelineSelectDirty);
     if (flushData.pipelineSelectDirty) {
         PreambleHelper<GfxFamily>::programPipelineSelect(&csrStream, flushData.pipelineSelectArgs, peekRootDeviceEnvironment());
         this->streamProperties.pipelineSelect.clearIsDirty();
@@ -1968,6 +1976,7 @@ void CommandStreamReceiverHw<GfxFamily>::handleImmediateFlushFrontEndState(Immed
 
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::dispatchImmediateFlushFrontEndCommand(ImmediateFlushData &flushData, Device &device, LinearStream &csrStream) {
+    this->stateCommandStatistics.record(StateCommandType::frontEnd, flushData.frontEndDirty);
     if (flushData.frontEndDirty) {
         auto &gfxCoreHelper = getGfxCoreHelper();
         auto engineGroupType = gfxCoreHelper.getEngineGroupType(getOsContext().getEngineType(), getOsContext().getEngineUsage(), peekHwInfo());
@@ -2001,6 +2010,7 @@ void CommandStreamReceiverHw<GfxFamily>::handleImmediateFlushStateComputeModeSta
 
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::dispatchImmediateFlushStateComputeModeCommand(ImmediateFlushData &flushData, LinearStream &csrStream) {
+    this->stateCommandStatistics.record(StateCommandType::stateComputeMode, flushData.stateComputeModeDirty);
     if (flushData.stateComputeModeDirty) {
         EncodeComputeMode<GfxFamily>::programComputeModeCommandWithSynchronization(csrStream, this->streamProperties.stateComputeMode,
                                                                                    flushData.pipelineSelectArgs,
@@ -2040,6 +2050,7 @@ void CommandStreamReceiverHw<GfxFamily>::handleImmediateFlushStateBaseAddressSta
 
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::dispatchImmediateFlushStateBaseAddressCommand(ImmediateFlushData &flushData, LinearStream &csrStream, Device &device) {
+    this->stateCommandStatistics.record(StateCommandType::stateBaseAddress, flushData.stateBaseAddressDirty);
     if (flushData.stateBaseAddressDirty) {
         bool btCommandNeeded = this->streamProperties.stateBaseAddress.bindingTablePoolBaseAddress.value != StreamProperty64::initValue;
         programStateBaseAddressCommon(nullptr, nullptr, nullptr, &this->streamProperties.stateBaseAddress,
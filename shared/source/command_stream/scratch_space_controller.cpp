@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/gfx_core_helper.h"
@@ -14,6 +15,8 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
     : rootDeviceIndex(rootDeviceIndex), executionEnvironment(environment), csrAllocationStorage(allocationStorage) {
@@ -24,6 +27,7 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
+    PRINT_DEBUG_STRING(debugManager.flags.PrintScratchSpaceHighWaterMark.get(), stdout, "Scratch space high-water mark for root device %u: %zu bytes\n", rootDeviceIndex, scratchSpaceHighWaterMark);
     if (scratchSlot0Allocation) {
         getMemoryManager()->freeGraphicsMemory(scratchSlot0Allocation);
     }
@@ -32,6 +36,23 @@ ScratchSpaceController::~ScratchSpaceController() {
     }
 }
 
+void ScratchSpaceController::releaseScratchSpace() {
+    if (scratchSlot0Allocation) {
+        csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchSlot0Allocation), TEMPORARY_ALLOCATION);
+        scratchSlot0Allocation = nullptr;
+    }
+    if (scratchSlot1Allocation) {
+        csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchSlot1Allocation), TEMPORARY_ALLOCATION);
+        scratchSlot1Allocation = nullptr;
+    }
+    scratchSlot0SizeInBytes = 0;
+    scratchSlot1SizeInBytes = 0;
+}
+
+void ScratchSpaceController::updateScratchSpaceHighWaterMark() {
+    scratchSpaceHighWaterMark = std::max(scratchSpaceHighWaterMark, scratchSlot0SizeInBytes + scratchSlot1SizeInBytes);
+}
+
 MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,11 @@ class ScratchSpaceController : NonCopyableOrMovableClass {
                                          bool &stateBaseAddressDirty,
                                          bool &vfeStateDirty) = 0;
 
+    virtual void releaseScratchSpace();
+    size_t getScratchSpaceHighWaterMark() const {
+        return scratchSpaceHighWaterMark;
+    }
+
     virtual uint64_t calculateNewGSH() = 0;
     virtual uint64_t getScratchPatchAddress() = 0;
     inline uint32_t getPerThreadScratchSpaceSizeSlot0() {
@@ -75,6 +80,7 @@ class ScratchSpaceController : NonCopyableOrMovableClass {
 
   protected:
     MemoryManager *getMemoryManager() const;
+    void updateScratchSpaceHighWaterMark();
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
@@ -83,6 +89,7 @@ class ScratchSpaceController : NonCopyableOrMovableClass {
     InternalAllocationStorage &csrAllocationStorage;
     size_t scratchSlot0SizeInBytes = 0;
     size_t scratchSlot1SizeInBytes = 0;
+    size_t scratchSpaceHighWaterMark = 0;
     bool force32BitAllocation = false;
     uint32_t computeUnitsUsedForScratch = 0;
 };
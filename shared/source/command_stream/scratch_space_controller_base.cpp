@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
         }
         scratchSlot0SizeInBytes = requiredScratchSizeInBytes;
         createScratchSpaceAllocation();
+        updateScratchSpaceHighWaterMark();
         vfeStateDirty = true;
         force32BitAllocation = getMemoryManager()->peekForce32BitAllocations();
         if (is64bit && !force32BitAllocation) {
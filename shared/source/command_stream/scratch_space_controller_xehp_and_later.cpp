@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -104,6 +104,14 @@ void ScratchSpaceControllerXeHPAndLater::programSurfaceStateAtPtr(void *surfaceS
     }
 }
 
+void ScratchSpaceControllerXeHPAndLater::releaseScratchSpace() {
+    ScratchSpaceController::releaseScratchSpace();
+    perThreadScratchSize = 0;
+    perThreadScratchSpaceSlot1Size = 0;
+    // scratch is released only when engine is idle, so surface state slots can be reused from the beginning
+    slotId = 0;
+}
+
 uint64_t ScratchSpaceControllerXeHPAndLater::calculateNewGSH() {
     return 0u;
 }
@@ -188,6 +196,9 @@ void ScratchSpaceControllerXeHPAndLater::prepareScratchAllocation(uint32_t requi
             scratchSlot1Allocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
         }
     }
+    if (scratchSurfaceDirty) {
+        updateScratchSpaceHighWaterMark();
+    }
 }
 
 void ScratchSpaceControllerXeHPAndLater::programHeaps(HeapContainer &heapContainer,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@ class ScratchSpaceControllerXeHPAndLater : public ScratchSpaceController {
                                  bool &stateBaseAddressDirty,
                                  bool &vfeStateDirty) override;
 
+    void releaseScratchSpace() override;
     uint64_t calculateNewGSH() override;
     uint64_t getScratchPatchAddress() override;
 
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+
+namespace NEO {
+
+enum class StateCommandType : uint32_t {
+    frontEnd = 0,
+    pipelineSelect,
+    stateComputeMode,
+    stateBaseAddress,
+    count
+};
+
+struct StateCommandStatistics {
+    struct Counters {
+        uint64_t emitted = 0;
+        uint64_t elided = 0;
+    };
+
+    static constexpr const char *getStateCommandName(StateCommandType type) {
+        switch (type) {
+        case StateCommandType::frontEnd:
+            return "FrontEnd";
+        case StateCommandType::pipelineSelect:
+            return "PipelineSelect";
+        case StateCommandType::stateComputeMode:
+            return "StateComputeMode";
+        case StateCommandType::stateBaseAddress:
+            return "StateBaseAddress";
+        default:
+            return "Unknown";
+        }
+    }
+
+    void record(StateCommandType type, bool emitted) {
+        auto &typeCounters = this->counters[static_cast<uint32_t>(type)];
+        if (emitted) {
+            typeCounters.emitted++;
+        } else {
+            typeCounters.elided++;
+        }
+    }
+
+    const Counters &getCounters(StateCommandType type) const {
+        return this->counters[static_cast<uint32_t>(type)];
+    }
+
+    void reset() {
+        this->counters.fill({});
+    }
+
+    void print(uint32_t contextId) const {
+        printf("\n--- State commands statistics for context %u ---\n", contextId);
+        printf("%20s %15s %15s\n", "Command", "Emitted", "Elided");
+        for (uint32_t i = 0; i < static_cast<uint32_t>(StateCommandType::count); i++) {
+            printf("%20s %15llu %15llu\n", getStateCommandName(static_cast<StateCommandType>(i)),
+                   static_cast<unsigned long long>(this->counters[i].emitted),
+                   static_cast<unsigned long long>(this->counters[i].elided));
+        }
+    }
+
+  protected:
+    std::array<Counters, static_cast<uint32_t>(StateCommandType::count)> counters{};
+};
+
+} // namespace NEO
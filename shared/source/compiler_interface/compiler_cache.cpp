@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,14 +7,18 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/lz_compression.h"
 
 #include "config.h"
 #include "os_inc.h"
@@ -24,6 +28,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace NEO {
 std::mutex CompilerCache::cacheAccessMtx;
@@ -32,8 +37,9 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
                                                    const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
-    Hash hash;
+    WideHash hash;
 
+    hash.update(safePodCast<const char *>(&cacheKeyVersion), sizeof(cacheKeyVersion));
     hash.update("----", 4);
     hash.update(&*igcRevision.begin(), igcRevision.size());
     hash.update(safePodCast<const char *>(&igcLibSize), sizeof(igcLibSize));
@@ -75,6 +81,8 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
         std::lock_guard<std::mutex> lock(cacheAccessMtx);
         auto fp = NEO::IoFunctions::fopenPtr(traceFilePath.c_str(), "w");
         if (fp) {
+            NEO::IoFunctions::fprintf(fp, "---- key version ----\n");
+            NEO::IoFunctions::fprintf(fp, "%u\n", cacheKeyVersion);
             NEO::IoFunctions::fprintf(fp, "---- igcRevision ----\n");
             NEO::IoFunctions::fprintf(fp, "%s\n", &*igcRevision.begin());
             NEO::IoFunctions::fprintf(fp, "  libSize=%llu\n", igcLibSize);
@@ -136,6 +144,130 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (config.enabled && config.usePackFile) {
+        // pack name must not contain cache file extension, otherwise per-file eviction would remove it
+        std::string packFileName = config.cacheFileExtension;
+        if (!packFileName.empty() && packFileName[0] == '.') {
+            packFileName.erase(0, 1);
+        }
+        pack = CompilerCachePack::getOrCreate(joinPath(config.cacheDir, packFileName + ".pack"), config.cacheSize);
+    }
+};
+
+CompilerCache::~CompilerCache() {
+    if (debugManager.flags.PrintCompilerCacheStatistics.get()) {
+        auto statistics = getStatistics();
+        printf("Compiler cache statistics: memory hits %llu, memory misses %llu, memory bytes loaded %llu, memory tier used %zu of %zu bytes, disk hits %llu, disk misses %llu, disk bytes loaded %llu\n",
+               static_cast<unsigned long long>(statistics.memoryHits), static_cast<unsigned long long>(statistics.memoryMisses),
+               static_cast<unsigned long long>(statistics.memoryBytesLoaded),
+               memoryTier ? memoryTier->getUsedSize() : 0u, memoryTier ? memoryTier->getMaxSize() : 0u,
+               static_cast<unsigned long long>(statistics.diskHits), static_cast<unsigned long long>(statistics.diskMisses),
+               static_cast<unsigned long long>(statistics.diskBytesLoaded));
+    }
+}
+
+bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (memoryTier && pBinary != nullptr && binarySize != 0) {
+        memoryTier->insert(kernelFileHash, pBinary, binarySize);
+    }
+
+    std::vector<char> compressedBinary;
+    if (config.compressionEnabled && pBinary != nullptr && binarySize != 0 && binarySize <= LzCompression::maxDecompressedSize) {
+        compressedBinary = LzCompression::compress(pBinary, binarySize, LzCompression::defaultBlockSize);
+        if (compressedBinary.size() < binarySize) {
+            pBinary = compressedBinary.data();
+            binarySize = compressedBinary.size();
+        }
+    }
+
+    if (pack) {
+        return pack->store(kernelFileHash, pBinary, binarySize);
+    }
+    return cacheBinaryOnDisk(kernelFileHash, pBinary, binarySize);
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (memoryTier) {
+        auto binary = memoryTier->find(kernelFileHash, cachedBinarySize);
+        if (binary) {
+            memoryHits++;
+            memoryBytesLoaded += cachedBinarySize;
+            auto binaryCopy = std::make_unique<char[]>(cachedBinarySize);
+            memcpy_s(binaryCopy.get(), cachedBinarySize, binary.get(), cachedBinarySize);
+            return binaryCopy;
+        }
+        memoryMisses++;
+    }
+
+    auto binary = pack ? pack->load(kernelFileHash, cachedBinarySize)
+                       : loadCachedBinaryFromDisk(kernelFileHash, cachedBinarySize);
+    if (binary && LzCompression::isCompressed(binary.get(), cachedBinarySize)) {
+        binary = LzCompression::decompress(binary.get(), cachedBinarySize, cachedBinarySize, LzCompression::maxDecompressionThreads, workerPool);
+    }
+    if (binary) {
+        diskHits++;
+        diskBytesLoaded += cachedBinarySize;
+        if (memoryTier) {
+            memoryTier->insert(kernelFileHash, binary.get(), cachedBinarySize);
+        }
+    } else {
+        diskMisses++;
+    }
+    return binary;
+}
+
+CompilerCacheStatistics CompilerCache::getStatistics() const {
+    CompilerCacheStatistics statistics;
+    statistics.memoryHits = memoryHits;
+    statistics.memoryMisses = memoryMisses;
+    statistics.memoryBytesLoaded = memoryBytesLoaded;
+    statistics.diskHits = diskHits;
+    statistics.diskMisses = diskMisses;
+    statistics.diskBytesLoaded = diskBytesLoaded;
+    return statistics;
+}
+
+CompilerCacheMemoryTier::Binary CompilerCacheMemoryTier::find(const std::string &kernelFileHash, size_t &binarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it == entriesByHash.end()) {
+        binarySize = 0;
+        return nullptr;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    binarySize = it->second->binarySize;
+    return it->second->binary;
+}
+
+void CompilerCacheMemoryTier::insert(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (binarySize > maxSize) {
+        return;
+    }
+
+    std::shared_ptr<char[]> binary(new char[binarySize]);
+    memcpy_s(binary.get(), binarySize, pBinary, binarySize);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entriesByHash.find(kernelFileHash) != entriesByHash.end()) {
+        return;
+    }
+
+    while (usedSize + binarySize > maxSize) {
+        auto &leastRecentlyUsed = entries.back();
+        usedSize -= leastRecentlyUsed.binarySize;
+        entriesByHash.erase(leastRecentlyUsed.kernelFileHash);
+        entries.pop_back();
+    }
+
+    entries.push_front({kernelFileHash, std::move(binary), binarySize});
+    entriesByHash[kernelFileHash] = entries.begin();
+    usedSize += binarySize;
+}
+
+size_t CompilerCacheMemoryTier::getUsedSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return usedSize;
+}
 
 } // namespace NEO
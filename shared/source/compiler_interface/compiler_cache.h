@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,13 +10,17 @@
 #include "shared/source/os_interface/os_handle.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <atomic>
 #include <cstdint>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 
 namespace NEO {
+class CompilerCachePack;
+class WorkerPool;
 struct HardwareInfo;
 
 struct CompilerCacheConfig {
@@ -24,12 +28,53 @@ struct CompilerCacheConfig {
     std::string cacheFileExtension;
     std::string cacheDir;
     size_t cacheSize = 0;
+    size_t memoryCacheSize = 0;
+    bool usePackFile = false;
+    bool compressionEnabled = false;
+};
+
+struct CompilerCacheStatistics {
+    uint64_t memoryHits = 0;
+    uint64_t memoryMisses = 0;
+    uint64_t memoryBytesLoaded = 0;
+    uint64_t diskHits = 0;
+    uint64_t diskMisses = 0;
+    uint64_t diskBytesLoaded = 0;
+};
+
+class CompilerCacheMemoryTier {
+  public:
+    using Binary = std::shared_ptr<const char[]>;
+
+    CompilerCacheMemoryTier(size_t maxSize) : maxSize(maxSize) {}
+
+    Binary find(const std::string &kernelFileHash, size_t &binarySize);
+    void insert(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    size_t getUsedSize() const;
+    size_t getMaxSize() const { return maxSize; }
+
+  protected:
+    struct Entry {
+        std::string kernelFileHash;
+        Binary binary;
+        size_t binarySize = 0;
+    };
+    using EntryList = std::list<Entry>;
+
+    mutable std::mutex mtx;
+    EntryList entries;
+    std::unordered_map<std::string, EntryList::iterator> entriesByHash;
+    size_t usedSize = 0;
+    const size_t maxSize;
 };
 
 class CompilerCache {
   public:
+    // bump whenever inputs or hashing algorithm of cache keys change
+    static constexpr uint32_t cacheKeyVersion = 2u;
+
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -47,7 +92,13 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
+    CompilerCacheStatistics getStatistics() const;
+    void setMemoryTier(CompilerCacheMemoryTier *tier) { memoryTier = tier; }
+    void setWorkerPool(WorkerPool *pool) { workerPool = pool; }
+
   protected:
+    MOCKABLE_VIRTUAL bool cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize);
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
     MOCKABLE_VIRTUAL bool renameTempFileBinaryToProperName(const std::string &oldName, const std::string &kernelFileHash);
     MOCKABLE_VIRTUAL bool createUniqueTempFileAndWriteData(char *tmpFilePathTemplate, const char *pBinary, size_t binarySize);
@@ -55,5 +106,15 @@ class CompilerCache {
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+    CompilerCacheMemoryTier *memoryTier = nullptr; // shared by all root devices, owned by ExecutionEnvironment
+    WorkerPool *workerPool = nullptr;              // decompresses large entries in parallel, owned by ExecutionEnvironment
+    std::shared_ptr<CompilerCachePack> pack;       // shared by all caches using the same pack file
+
+    std::atomic<uint64_t> memoryHits = 0;
+    std::atomic<uint64_t> memoryMisses = 0;
+    std::atomic<uint64_t> memoryBytesLoaded = 0;
+    std::atomic<uint64_t> diskHits = 0;
+    std::atomic<uint64_t> diskMisses = 0;
+    std::atomic<uint64_t> diskBytesLoaded = 0;
 };
 } // namespace NEO
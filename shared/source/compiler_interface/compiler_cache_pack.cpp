@@ -0,0 +1,535 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/mapped_file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+struct PackRegistry {
+    std::mutex mtx;
+    std::map<std::string, std::weak_ptr<CompilerCachePack>> packs;
+};
+// every pack holds a reference in its deleter, so the registry outlives packs released during static destruction
+std::shared_ptr<PackRegistry> packRegistry = std::make_shared<PackRegistry>();
+
+std::atomic<uint32_t> tempFileCounter{0u};
+} // namespace
+
+std::shared_ptr<CompilerCachePack> CompilerCachePack::getOrCreate(const std::string &packFilePath, size_t maxSize) {
+    auto registry = packRegistry;
+    std::lock_guard<std::mutex> lock(registry->mtx);
+    auto &registeredPack = registry->packs[packFilePath];
+    auto pack = registeredPack.lock();
+    if (pack == nullptr) {
+        pack = std::shared_ptr<CompilerCachePack>(new CompilerCachePack(packFilePath, maxSize), [registry](CompilerCachePack *pack) {
+            pack->flushUsage();
+            {
+                std::lock_guard<std::mutex> lock(registry->mtx);
+                auto it = registry->packs.find(pack->packFilePath);
+                if (it != registry->packs.end() && it->second.expired()) {
+                    registry->packs.erase(it);
+                }
+            }
+            delete pack;
+        });
+        pack->open();
+        registeredPack = pack;
+    }
+    return pack;
+}
+
+CompilerCachePack::CompilerCachePack(const std::string &packFilePath, size_t maxSize)
+    : packFilePath(packFilePath), lockFilePath(packFilePath + ".lock"),
+      maxSize(std::min(maxSize, static_cast<size_t>(std::numeric_limits<long>::max()))) {
+}
+
+CompilerCachePack::~CompilerCachePack() = default;
+
+bool CompilerCachePack::open() {
+    std::lock_guard<std::mutex> writerLock(writerMtx);
+    UnifiedHandle lockHandle{};
+    if (!lockPackFile(lockHandle)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        packSize = 0;
+    }
+    const bool success = refreshIndex();
+    unlockPackFile(lockHandle);
+    return success;
+}
+
+bool CompilerCachePack::store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (pBinary == nullptr || binarySize == 0 || kernelFileHash.size() > maxHashSize) {
+        return false;
+    }
+
+    const auto recordSize = getRecordSize(kernelFileHash.size(), binarySize);
+    if (sizeof(FileHeader) + recordSize > maxSize) {
+        return false;
+    }
+
+    const auto checksum = WideHash::hash(pBinary, binarySize);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (index.find(kernelFileHash) != index.end()) {
+            return true;
+        }
+    }
+
+    // writers are serialized within the process by writerMtx and between processes by the pack file lock
+    std::lock_guard<std::mutex> writerLock(writerMtx);
+    UnifiedHandle lockHandle{};
+    if (!lockPackFile(lockHandle)) {
+        return false;
+    }
+    bool success = refreshIndex();
+    bool alreadyStored = false;
+    if (success) {
+        std::lock_guard<std::mutex> lock(mtx);
+        alreadyStored = index.find(kernelFileHash) != index.end();
+    }
+    if (success && !alreadyStored) {
+        success = compact(recordSize) && appendRecords(&kernelFileHash, pBinary, binarySize, checksum);
+    }
+    unlockPackFile(lockHandle);
+    return success;
+}
+
+std::unique_ptr<char[]> CompilerCachePack::load(const std::string &kernelFileHash, size_t &binarySize) {
+    binarySize = 0;
+
+    IndexEntry entry{};
+    std::shared_ptr<MappedFile> view;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = index.find(kernelFileHash);
+        if (it == index.end()) {
+            return nullptr;
+        }
+        it->second.lruStamp = ++lastLruStamp;
+        it->second.usagePending = true;
+        entry = it->second;
+        view = packView;
+    }
+
+    // view is only released for the duration of a pack rewrite
+    if (view == nullptr) {
+        return nullptr;
+    }
+
+    // offsets in the index refer to the mapped view, which stays valid even if the pack file is replaced meanwhile
+    const auto packData = view->getData();
+    const char *binarySrc = reinterpret_cast<const char *>(packData.begin()) + entry.binaryOffset;
+    if (entry.binaryOffset + entry.binarySize > packData.size() ||
+        WideHash::hash(binarySrc, static_cast<size_t>(entry.binarySize)) != entry.checksum) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = index.find(kernelFileHash);
+        if (it != index.end() && it->second.binaryOffset == entry.binaryOffset) {
+            removeFromIndex(kernelFileHash);
+        }
+        return nullptr;
+    }
+
+    binarySize = static_cast<size_t>(entry.binarySize);
+    auto binary = std::make_unique<char[]>(binarySize);
+    memcpy_s(binary.get(), binarySize, binarySrc, binarySize);
+    return binary;
+}
+
+bool CompilerCachePack::flushUsage() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (std::none_of(index.begin(), index.end(), [](const auto &indexEntry) { return indexEntry.second.usagePending; })) {
+            return true;
+        }
+    }
+
+    std::lock_guard<std::mutex> writerLock(writerMtx);
+    UnifiedHandle lockHandle{};
+    if (!lockPackFile(lockHandle)) {
+        return false;
+    }
+    const bool success = refreshIndex() && appendRecords(nullptr, nullptr, 0u, 0u);
+    unlockPackFile(lockHandle);
+    return success;
+}
+
+size_t CompilerCachePack::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return index.size();
+}
+
+size_t CompilerCachePack::getPackSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return static_cast<size_t>(packSize);
+}
+
+bool CompilerCachePack::refreshIndex() {
+    // pack file lock is held, so the pack is neither appended to nor replaced while it is mapped and parsed
+    const auto fileSize = getFileSize();
+    auto view = (fileSize != 0) ? mapPackFile() : nullptr;
+    if (fileSize != 0 && view == nullptr) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "[Cache failure]: Mapping compiler cache pack %s failed\n", packFilePath.c_str());
+        return false;
+    }
+    const auto packData = view ? view->getData() : ArrayRef<const uint8_t>();
+
+    FileHeader fileHeader{};
+    if (packData.size() >= sizeof(FileHeader)) {
+        memcpy_s(&fileHeader, sizeof(fileHeader), packData.begin(), sizeof(fileHeader));
+    }
+    const bool validHeader = memcmp(fileHeader.magic, packHeader, sizeof(packHeader)) == 0;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    // records appended since the last refresh are parsed from where parsing stopped,
+    // a pack rewritten or recreated by another process is parsed from the beginning
+    const bool samePack = validHeader && packSize != 0 && fileHeader.generation == generation && packData.size() >= packSize;
+    if (!samePack) {
+        index.clear();
+        parsedSize = sizeof(FileHeader);
+        generation = fileHeader.generation;
+    }
+    packView = std::move(view);
+    packSize = packData.size();
+
+    if (packData.empty()) {
+        rewriteRequired = false;
+        return true;
+    }
+    if (!validHeader) {
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "[Cache failure]: Invalid compiler cache pack %s, it will be rewritten\n", packFilePath.c_str());
+        rewriteRequired = true;
+        return true;
+    }
+
+    parsedSize = parseRecords(packData, parsedSize);
+    rewriteRequired = (parsedSize != packSize);
+    return true;
+}
+
+uint64_t CompilerCachePack::parseRecords(ArrayRef<const uint8_t> packData, uint64_t offset) {
+    while (offset + sizeof(RecordHeader) <= packData.size()) {
+        RecordHeader recordHeader{};
+        memcpy_s(&recordHeader, sizeof(recordHeader), packData.begin() + offset, sizeof(recordHeader));
+        if (recordHeader.hashSize > maxHashSize ||
+            recordHeader.binarySize > packData.size() ||
+            offset + getRecordSize(recordHeader.hashSize, recordHeader.binarySize) > packData.size()) {
+            break;
+        }
+
+        const std::string kernelFileHash(reinterpret_cast<const char *>(packData.begin() + offset + sizeof(RecordHeader)), recordHeader.hashSize);
+        const auto payloadOffset = offset + sizeof(RecordHeader) + recordHeader.hashSize;
+        auto nextOffset = offset + getRecordSize(recordHeader.hashSize, recordHeader.binarySize);
+
+        if (recordHeader.magic == RecordHeader::recordMagic) {
+            addToIndex(kernelFileHash, payloadOffset, recordHeader.binarySize, recordHeader.checksum, ++lastLruStamp);
+        } else if (recordHeader.magic == RecordHeader::usageRecordMagic) {
+            auto it = index.find(kernelFileHash);
+            if (it != index.end()) {
+                it->second.lruStamp = ++lastLruStamp;
+            }
+        } else if (recordHeader.magic != RecordHeader::indexRecordMagic ||
+                   !parseIndexRecord(packData, payloadOffset, recordHeader, nextOffset)) {
+            break;
+        }
+        offset = nextOffset;
+    }
+    return offset;
+}
+
+bool CompilerCachePack::parseIndexRecord(ArrayRef<const uint8_t> packData, uint64_t payloadOffset, const RecordHeader &recordHeader, uint64_t &recordsEnd) {
+    const auto payload = reinterpret_cast<const char *>(packData.begin() + payloadOffset);
+    const auto payloadEnd = payloadOffset + recordHeader.binarySize;
+    if (recordHeader.binarySize < sizeof(uint64_t) ||
+        WideHash::hash(payload, static_cast<size_t>(recordHeader.binarySize)) != recordHeader.checksum) {
+        return false;
+    }
+
+    uint64_t listedRecordsEnd = 0;
+    memcpy_s(&listedRecordsEnd, sizeof(listedRecordsEnd), payload, sizeof(listedRecordsEnd));
+    if (listedRecordsEnd < payloadEnd || listedRecordsEnd > packData.size()) {
+        return false;
+    }
+
+    auto offset = payloadOffset + sizeof(uint64_t);
+    while (offset + sizeof(IndexRecordEntry) <= payloadEnd) {
+        IndexRecordEntry entry{};
+        memcpy_s(&entry, sizeof(entry), packData.begin() + offset, sizeof(entry));
+        offset += sizeof(IndexRecordEntry);
+        if (entry.hashSize > maxHashSize || offset + entry.hashSize > payloadEnd ||
+            entry.binaryOffset > listedRecordsEnd || entry.binarySize > listedRecordsEnd - entry.binaryOffset) {
+            return false;
+        }
+        const std::string kernelFileHash(reinterpret_cast<const char *>(packData.begin() + offset), entry.hashSize);
+        offset += entry.hashSize;
+        addToIndex(kernelFileHash, entry.binaryOffset, entry.binarySize, entry.checksum, entry.lruStamp);
+        lastLruStamp = std::max(lastLruStamp, entry.lruStamp);
+    }
+
+    // records listed in the index are not parsed again, their LRU stamps come from the index
+    recordsEnd = listedRecordsEnd;
+    return offset == payloadEnd;
+}
+
+bool CompilerCachePack::appendRecords(const std::string *kernelFileHash, const char *pBinary, size_t binarySize, uint64_t checksum) {
+    // pack file lock is held and the index was refreshed, so packSize is where the records land
+    std::vector<char> data;
+    uint64_t fileSize = 0;
+    std::vector<std::pair<uint64_t, std::string>> usedEntries;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        fileSize = packSize;
+        for (auto &indexEntry : index) {
+            if (indexEntry.second.usagePending) {
+                indexEntry.second.usagePending = false;
+                usedEntries.emplace_back(indexEntry.second.lruStamp, indexEntry.first);
+            }
+        }
+    }
+    std::sort(usedEntries.begin(), usedEntries.end());
+
+    if (fileSize == 0) {
+        if (kernelFileHash == nullptr) {
+            return true;
+        }
+        FileHeader fileHeader{};
+        memcpy_s(fileHeader.magic, sizeof(fileHeader.magic), packHeader, sizeof(packHeader));
+        data.resize(sizeof(FileHeader));
+        memcpy_s(data.data(), data.size(), &fileHeader, sizeof(fileHeader));
+    }
+
+    if (kernelFileHash != nullptr) {
+        const auto recordSize = static_cast<size_t>(getRecordSize(kernelFileHash->size(), binarySize));
+        if (fileSize + data.size() + recordSize > maxSize) {
+            std::lock_guard<std::mutex> lock(mtx);
+            rewriteRequired = true;
+            return false;
+        }
+
+        RecordHeader recordHeader{};
+        recordHeader.hashSize = static_cast<uint32_t>(kernelFileHash->size());
+        recordHeader.binarySize = binarySize;
+        recordHeader.checksum = checksum;
+
+        data.resize(data.size() + recordSize);
+        auto dst = data.data() + data.size() - recordSize;
+        memcpy_s(dst, sizeof(RecordHeader), &recordHeader, sizeof(RecordHeader));
+        dst += sizeof(RecordHeader);
+        memcpy_s(dst, kernelFileHash->size(), kernelFileHash->data(), kernelFileHash->size());
+        dst += kernelFileHash->size();
+        memcpy_s(dst, binarySize, pBinary, binarySize);
+    }
+
+    // usage records are best effort, they are dropped when they do not fit into the pack
+    for (const auto &usedEntry : usedEntries) {
+        const auto &usedHash = usedEntry.second;
+        const auto usageRecordSize = static_cast<size_t>(getRecordSize(usedHash.size(), 0u));
+        if (fileSize + data.size() + usageRecordSize > maxSize) {
+            break;
+        }
+
+        RecordHeader recordHeader{};
+        recordHeader.magic = RecordHeader::usageRecordMagic;
+        recordHeader.hashSize = static_cast<uint32_t>(usedHash.size());
+
+        data.resize(data.size() + usageRecordSize);
+        auto dst = data.data() + data.size() - usageRecordSize;
+        memcpy_s(dst, sizeof(RecordHeader), &recordHeader, sizeof(RecordHeader));
+        memcpy_s(dst + sizeof(RecordHeader), usedHash.size(), usedHash.data(), usedHash.size());
+    }
+
+    uint64_t offset = 0;
+    if (!data.empty() && !appendToFile(data.data(), data.size(), offset)) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "[Cache failure]: Appending to compiler cache pack %s failed\n", packFilePath.c_str());
+        return false;
+    }
+
+    // appended records are indexed and mapped like records of any other writer
+    return refreshIndex();
+}
+
+void CompilerCachePack::addToIndex(const std::string &kernelFileHash, uint64_t binaryOffset, uint64_t binarySize, uint64_t checksum, uint64_t lruStamp) {
+    index[kernelFileHash] = {binaryOffset, binarySize, checksum, lruStamp, false};
+}
+
+void CompilerCachePack::removeFromIndex(const std::string &kernelFileHash) {
+    index.erase(kernelFileHash);
+}
+
+bool CompilerCachePack::compact(uint64_t recordSize) {
+    struct KeptRecord {
+        std::string kernelFileHash;
+        IndexEntry entry;
+    };
+    std::vector<KeptRecord> liveRecords;
+    std::vector<KeptRecord> keptRecords;
+    std::shared_ptr<MappedFile> view;
+    FileHeader fileHeader{};
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!rewriteRequired && packSize + recordSize <= maxSize) {
+            return true;
+        }
+        liveRecords.reserve(index.size());
+        for (const auto &indexEntry : index) {
+            liveRecords.push_back({indexEntry.first, indexEntry.second});
+        }
+        view = packView;
+        fileHeader.generation = generation + 1;
+    }
+    memcpy_s(fileHeader.magic, sizeof(fileHeader.magic), packHeader, sizeof(packHeader));
+
+    // index was refreshed under the pack file lock, so it lists records of all processes
+    std::sort(liveRecords.begin(), liveRecords.end(), [](const KeptRecord &lhs, const KeptRecord &rhs) { return lhs.entry.lruStamp > rhs.entry.lruStamp; });
+
+    const auto evictionLimit = maxSize / 3;
+    const auto targetSize = maxSize - std::max<uint64_t>(evictionLimit, recordSize);
+    uint64_t indexRecordSize = sizeof(RecordHeader) + sizeof(uint64_t);
+    uint64_t keptRecordsSize = 0;
+    for (const auto &liveRecord : liveRecords) {
+        const auto indexEntrySize = sizeof(IndexRecordEntry) + liveRecord.kernelFileHash.size();
+        const auto liveRecordSize = getRecordSize(liveRecord.kernelFileHash.size(), liveRecord.entry.binarySize);
+        if (sizeof(FileHeader) + indexRecordSize + indexEntrySize + keptRecordsSize + liveRecordSize > targetSize) {
+            break;
+        }
+        keptRecords.push_back(liveRecord);
+        indexRecordSize += indexEntrySize;
+        keptRecordsSize += liveRecordSize;
+    }
+
+    // rewritten pack starts with the index of its records, so opening it does not parse every record
+    std::vector<char> indexRecord(static_cast<size_t>(indexRecordSize));
+    auto payload = indexRecord.data() + sizeof(RecordHeader);
+    const uint64_t keptRecordsEnd = sizeof(FileHeader) + indexRecordSize + keptRecordsSize;
+    memcpy_s(payload, sizeof(keptRecordsEnd), &keptRecordsEnd, sizeof(keptRecordsEnd));
+    auto dst = payload + sizeof(keptRecordsEnd);
+    uint64_t recordOffset = sizeof(FileHeader) + indexRecordSize;
+    for (const auto &keptRecord : keptRecords) {
+        const auto &kernelFileHash = keptRecord.kernelFileHash;
+        IndexRecordEntry indexRecordEntry{};
+        indexRecordEntry.binaryOffset = recordOffset + sizeof(RecordHeader) + kernelFileHash.size();
+        indexRecordEntry.binarySize = keptRecord.entry.binarySize;
+        indexRecordEntry.checksum = keptRecord.entry.checksum;
+        indexRecordEntry.lruStamp = keptRecord.entry.lruStamp;
+        indexRecordEntry.hashSize = static_cast<uint32_t>(kernelFileHash.size());
+        memcpy_s(dst, sizeof(IndexRecordEntry), &indexRecordEntry, sizeof(IndexRecordEntry));
+        dst += sizeof(IndexRecordEntry);
+        memcpy_s(dst, kernelFileHash.size(), kernelFileHash.data(), kernelFileHash.size());
+        dst += kernelFileHash.size();
+        recordOffset += getRecordSize(kernelFileHash.size(), keptRecord.entry.binarySize);
+    }
+    RecordHeader indexRecordHeader{};
+    indexRecordHeader.magic = RecordHeader::indexRecordMagic;
+    indexRecordHeader.binarySize = indexRecordSize - sizeof(RecordHeader);
+    indexRecordHeader.checksum = WideHash::hash(payload, static_cast<size_t>(indexRecordHeader.binarySize));
+    memcpy_s(indexRecord.data(), sizeof(RecordHeader), &indexRecordHeader, sizeof(RecordHeader));
+
+    if (!createTempFile()) {
+        return false;
+    }
+
+    // binaries are copied from the mapped view without holding the index lock, loads are not blocked by the rewrite;
+    // a binary damaged in the old pack is copied as is and fails its checksum on load like in the old pack
+    const auto packData = view->getData();
+    bool success = appendToTempFile(&fileHeader, sizeof(fileHeader)) &&
+                   appendToTempFile(indexRecord.data(), indexRecord.size());
+    for (const auto &keptRecord : keptRecords) {
+        if (!success) {
+            break;
+        }
+        const auto &kernelFileHash = keptRecord.kernelFileHash;
+        RecordHeader recordHeader{};
+        recordHeader.hashSize = static_cast<uint32_t>(kernelFileHash.size());
+        recordHeader.binarySize = keptRecord.entry.binarySize;
+        recordHeader.checksum = keptRecord.entry.checksum;
+        success = appendToTempFile(&recordHeader, sizeof(recordHeader)) &&
+                  appendToTempFile(kernelFileHash.data(), kernelFileHash.size()) &&
+                  appendToTempFile(packData.begin() + keptRecord.entry.binaryOffset, static_cast<size_t>(keptRecord.entry.binarySize));
+    }
+
+    // mapped file can not be replaced on Windows, so the view is released before the pack is replaced
+    view.reset();
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        packView.reset();
+    }
+    if (!closeTempFile(success) || !success) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "[Cache failure]: Rewriting compiler cache pack %s failed\n", packFilePath.c_str());
+        refreshIndex();
+        return false;
+    }
+
+    return refreshIndex();
+}
+
+uint64_t CompilerCachePack::getFileSize() {
+    auto file = IoFunctions::fopenPtr(packFilePath.c_str(), "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+    IoFunctions::fseekPtr(file, 0, SEEK_END);
+    auto fileSize = IoFunctions::ftellPtr(file);
+    IoFunctions::fclosePtr(file);
+    return fileSize > 0 ? static_cast<uint64_t>(fileSize) : 0u;
+}
+
+std::shared_ptr<MappedFile> CompilerCachePack::mapPackFile() {
+    return MappedFile::map(packFilePath);
+}
+
+bool CompilerCachePack::appendToFile(const void *src, size_t size, uint64_t &offset) {
+    auto file = IoFunctions::fopenPtr(packFilePath.c_str(), "ab");
+    if (file == nullptr) {
+        return false;
+    }
+    IoFunctions::fseekPtr(file, 0, SEEK_END);
+    auto fileSize = IoFunctions::ftellPtr(file);
+    bool success = fileSize >= 0 && IoFunctions::fwritePtr(src, 1, size, file) == size;
+    offset = static_cast<uint64_t>(fileSize);
+    IoFunctions::fclosePtr(file);
+    return success;
+}
+
+bool CompilerCachePack::createTempFile() {
+    tempFilePath = packFilePath + "." + std::to_string(SysCalls::getProcessId()) + "." + std::to_string(tempFileCounter++) + ".tmp";
+    tempFile = IoFunctions::fopenPtr(tempFilePath.c_str(), "wb");
+    return tempFile != nullptr;
+}
+
+bool CompilerCachePack::appendToTempFile(const void *src, size_t size) {
+    return IoFunctions::fwritePtr(src, 1, size, tempFile) == size;
+}
+
+bool CompilerCachePack::closeTempFile(bool replacePackFile) {
+    const bool closed = IoFunctions::fclosePtr(tempFile) == 0;
+    tempFile = nullptr;
+
+    // on failure the old pack is kept untouched, only the temporary file is removed
+    if (replacePackFile && closed && renameTempFileToPackFile()) {
+        return true;
+    }
+    removeTempFile();
+    return !replacePackFile;
+}
+
+} // namespace NEO
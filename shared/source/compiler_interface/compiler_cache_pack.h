@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/os_interface/os_handle.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+class MappedFile;
+
+// Single file backend of the compiler cache.
+// There is one pack object per pack file in the process, obtained with getOrCreate().
+// Records are only appended to the pack. Appends and rewrites are serialized between processes
+// with a lock file next to the pack. Before every append or rewrite the records appended by other
+// processes since the last look at the pack are added to the index, so a binary is not stored twice
+// and a rewrite keeps the records of all processes. Every record carries a checksum of its binary,
+// so a record torn by a crash is treated as a miss.
+// When the pack exceeds its size limit it is rewritten with the most recently used records only.
+// A rewritten pack starts with an index record listing its records with their LRU stamps, and gets
+// a new generation in the file header, which tells other processes to reload their index.
+// Binaries used since the last append are written as usage records, which move them to the front of the LRU order.
+// Loads read binaries from a memory mapped view of the pack, which is refreshed together with the index.
+// On Windows a mapped file can not be replaced, so a rewrite fails while other processes keep the pack mapped;
+// it is retried with the next store.
+// Pack size is capped so that all offsets fit in long, which is what IoFunctions seek/tell use.
+class CompilerCachePack {
+  public:
+    static constexpr char packHeader[8] = {'N', 'E', 'O', 'C', 'P', 'K', '0', '2'};
+    static constexpr uint32_t maxHashSize = 256u;
+
+    struct FileHeader {
+        char magic[sizeof(packHeader)] = {};
+        uint64_t generation = 0;
+    };
+    static_assert(sizeof(FileHeader) == 16);
+
+    struct RecordHeader {
+        static constexpr uint32_t recordMagic = 0x4b43504eu;
+        static constexpr uint32_t usageRecordMagic = 0x5543504eu;
+        static constexpr uint32_t indexRecordMagic = 0x4943504eu;
+
+        uint32_t magic = recordMagic;
+        uint32_t hashSize = 0;
+        uint64_t binarySize = 0;
+        uint64_t checksum = 0;
+    };
+    static_assert(sizeof(RecordHeader) == 24);
+
+    // index record payload is the end offset of the records it lists followed by IndexRecordEntry + hash for every record
+    struct IndexRecordEntry {
+        uint64_t binaryOffset = 0;
+        uint64_t binarySize = 0;
+        uint64_t checksum = 0;
+        uint64_t lruStamp = 0;
+        uint32_t hashSize = 0;
+        uint32_t reserved = 0;
+    };
+    static_assert(sizeof(IndexRecordEntry) == 40);
+
+    static std::shared_ptr<CompilerCachePack> getOrCreate(const std::string &packFilePath, size_t maxSize);
+
+    CompilerCachePack(const std::string &packFilePath, size_t maxSize);
+    virtual ~CompilerCachePack();
+
+    bool open();
+    bool store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> load(const std::string &kernelFileHash, size_t &binarySize);
+    bool flushUsage();
+
+    size_t getEntriesCount() const;
+    size_t getPackSize() const;
+
+  protected:
+    struct IndexEntry {
+        uint64_t binaryOffset = 0;
+        uint64_t binarySize = 0;
+        uint64_t checksum = 0;
+        uint64_t lruStamp = 0;
+        bool usagePending = false;
+    };
+
+    bool refreshIndex();
+    uint64_t parseRecords(ArrayRef<const uint8_t> packData, uint64_t offset);
+    bool parseIndexRecord(ArrayRef<const uint8_t> packData, uint64_t payloadOffset, const RecordHeader &recordHeader, uint64_t &recordsEnd);
+    bool appendRecords(const std::string *kernelFileHash, const char *pBinary, size_t binarySize, uint64_t checksum);
+    void addToIndex(const std::string &kernelFileHash, uint64_t binaryOffset, uint64_t binarySize, uint64_t checksum, uint64_t lruStamp);
+    void removeFromIndex(const std::string &kernelFileHash);
+    bool compact(uint64_t recordSize);
+    static uint64_t getRecordSize(size_t hashSize, uint64_t binarySize) {
+        return sizeof(RecordHeader) + hashSize + binarySize;
+    }
+
+    MOCKABLE_VIRTUAL uint64_t getFileSize();
+    MOCKABLE_VIRTUAL std::shared_ptr<MappedFile> mapPackFile();
+    MOCKABLE_VIRTUAL bool appendToFile(const void *src, size_t size, uint64_t &offset);
+    MOCKABLE_VIRTUAL bool createTempFile();
+    MOCKABLE_VIRTUAL bool appendToTempFile(const void *src, size_t size);
+    MOCKABLE_VIRTUAL bool closeTempFile(bool replacePackFile);
+    MOCKABLE_VIRTUAL bool lockPackFile(UnifiedHandle &lockHandle);
+    MOCKABLE_VIRTUAL void unlockPackFile(UnifiedHandle &lockHandle);
+    MOCKABLE_VIRTUAL bool renameTempFileToPackFile();
+    MOCKABLE_VIRTUAL void removeTempFile();
+
+    std::string packFilePath;
+    std::string lockFilePath;
+    std::string tempFilePath;
+    FILE *tempFile = nullptr;
+    const size_t maxSize;
+    uint64_t packSize = 0;
+    uint64_t parsedSize = 0;
+    uint64_t generation = 0;
+    uint64_t lastLruStamp = 0;
+    bool rewriteRequired = false;
+
+    std::shared_ptr<MappedFile> packView;
+    std::unordered_map<std::string, IndexEntry> index;
+    mutable std::mutex mtx;
+    std::mutex writerMtx;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,9 @@ namespace NEO {
 const std::string neoCachePersistent = "NEO_CACHE_PERSISTENT";
 const std::string neoCacheMaxSize = "NEO_CACHE_MAX_SIZE";
 const std::string neoCacheDir = "NEO_CACHE_DIR";
+const std::string neoCacheMemoryMaxSize = "NEO_CACHE_MEMORY_MAX_SIZE";
+const std::string neoCachePackFile = "NEO_CACHE_PACK_FILE";
+const std::string neoCacheCompression = "NEO_CACHE_COMPRESSION";
 
 const int64_t neoCacheMaxSizeDefault = static_cast<int64_t>(MemoryConstants::gigaByte);
 
@@ -54,6 +57,10 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
             ret.cacheSize = std::numeric_limits<size_t>::max();
         }
 
+        ret.memoryCacheSize = static_cast<size_t>(envReader.getSetting(neoCacheMemoryMaxSize.c_str(), static_cast<int64_t>(0)));
+        ret.usePackFile = envReader.getSetting(neoCachePackFile.c_str(), false);
+        ret.compressionEnabled = envReader.getSetting(neoCacheCompression.c_str(), false);
+
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "NEO_CACHE_PERSISTENT is enabled. Cache is located in: %s\n\n",
                            ret.cacheDir.c_str());
 
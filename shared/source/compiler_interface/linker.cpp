@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
@@ -22,6 +24,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "RelocationInfo.h"
 
@@ -325,7 +328,7 @@ LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const Segm
     if (!success) {
         return LinkingStatus::error;
     }
-    patchInstructionsSegments(instructionsSegments, outUnresolvedExternals, kernelDescriptors);
+    patchInstructionsSegments(instructionsSegments, outUnresolvedExternals, kernelDescriptors, pDevice);
     patchDataSegments(globalVariablesSegInfo, globalConstantsSegInfo, globalVariablesSeg, globalConstantsSeg,
                       outUnresolvedExternals, pDevice, constantsInitData, constantsInitDataSize, variablesInitData, variablesInitDataSize);
     removeLocalSymbolsFromRelocatedSymbols();
@@ -427,41 +430,76 @@ void Linker::removeLocalSymbolsFromRelocatedSymbols() {
     }
 }
 
-void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors) {
+void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors, Device *pDevice) {
     if (false == data.getTraits().requiresPatchingOfInstructionSegments) {
         return;
     }
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
-        auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
-                continue;
+
+    struct SegmentPatchResult {
+        UnresolvedExternals unresolvedExternals;
+        ImplicitArgsRelocationAddresses implicitArgsRelocationAddresses;
+    };
+    auto mergeSegmentPatchResult = [&](uint32_t segId, const SegmentPatchResult &result) {
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), result.unresolvedExternals.begin(), result.unresolvedExternals.end());
+        if (false == result.implicitArgsRelocationAddresses.empty()) {
+            auto &implicitArgsRelocationAddresses = pImplicitArgsRelocationAddresses[segId];
+            for (auto relocAddress : result.implicitArgsRelocationAddresses) {
+                implicitArgsRelocationAddresses.push_back(relocAddress);
             }
+        }
+    };
+
+    const auto parallelPatchingThreads = debugManager.flags.ParallelKernelDecodeThreads.get();
+    if ((parallelPatchingThreads > 1) && (relocationsPerSegment.size() > 1) && (pDevice != nullptr)) {
+        std::vector<SegmentPatchResult> results(relocationsPerSegment.size());
+        parallelFor(pDevice->getExecutionEnvironment()->getWorkerPool(), relocationsPerSegment.size(), static_cast<uint32_t>(parallelPatchingThreads), [&](size_t segId) {
+            patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], results[segId].unresolvedExternals, results[segId].implicitArgsRelocationAddresses, kernelDescriptors);
+        });
+
+        // merged in order of segments, so that results are the same as with sequential patching
+        for (uint32_t segId = 0U; segId < results.size(); segId++) {
+            mergeSegmentPatchResult(segId, results[segId]);
+        }
+        return;
+    }
+
+    for (uint32_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+        SegmentPatchResult result;
+        patchInstructionsSegment(segId, instructionsSegments[segId], result.unresolvedExternals, result.implicitArgsRelocationAddresses, kernelDescriptors);
+        mergeSegmentPatchResult(segId, result);
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, UnresolvedExternals &outUnresolvedExternals,
+                                      ImplicitArgsRelocationAddresses &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors) const {
+    for (const auto &relocation : data.getRelocationsInInstructionSegments()[segId]) {
+        UNRECOVERABLE_IF(nullptr == segment.hostPointer);
+        bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
+        if (invalidRelocation) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            DEBUG_BREAK_IF(true);
+            continue;
+        }
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
-                uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
-                *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
+        auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
+            uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
+            *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
+        } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+        } else if (relocation.symbolName.empty()) {
+            uint64_t patchValue = 0;
+            patchAddress(relocAddress, patchValue, relocation);
+        } else {
+            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+            if (symbolIt != relocatedSymbols.end()) {
+                uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
                 patchAddress(relocAddress, patchValue, relocation);
             } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
+                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
             }
         }
     }
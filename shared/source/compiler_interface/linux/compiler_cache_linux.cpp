@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -216,7 +216,7 @@ class HandleGuard {
     int fd = -1;
 };
 
-bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+bool CompilerCache::cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
     if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
         return false;
     }
@@ -277,7 +277,7 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
     return true;
 }
 
-std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize) {
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
 
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+
+namespace NEO {
+
+bool CompilerCachePack::lockPackFile(UnifiedHandle &lockHandle) {
+    errno = 0;
+    lockHandle = NEO::SysCalls::openWithMode(lockFilePath.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+    if (std::get<int>(lockHandle) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open pack lock file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return false;
+    }
+
+    if (NEO::SysCalls::flock(std::get<int>(lockHandle), LOCK_EX) < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock pack lock file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        NEO::SysCalls::close(std::get<int>(lockHandle));
+        lockHandle = -1;
+        return false;
+    }
+    return true;
+}
+
+void CompilerCachePack::unlockPackFile(UnifiedHandle &lockHandle) {
+    NEO::SysCalls::flock(std::get<int>(lockHandle), LOCK_UN);
+    NEO::SysCalls::close(std::get<int>(lockHandle));
+    lockHandle = -1;
+}
+
+bool CompilerCachePack::renameTempFileToPackFile() {
+    errno = 0;
+    if (NEO::SysCalls::rename(tempFilePath.c_str(), packFilePath.c_str()) != 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Rename pack temp file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return false;
+    }
+    return true;
+}
+
+void CompilerCachePack::removeTempFile() {
+    NEO::SysCalls::unlink(tempFilePath);
+}
+
+} // namespace NEO
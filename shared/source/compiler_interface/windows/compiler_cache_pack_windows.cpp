@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/windows/sys_calls.h"
+
+namespace NEO {
+
+bool CompilerCachePack::lockPackFile(UnifiedHandle &lockHandle) {
+    lockHandle = NEO::SysCalls::createFileA(lockFilePath.c_str(),
+                                            GENERIC_READ | GENERIC_WRITE,
+                                            FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                            NULL,
+                                            OPEN_ALWAYS,
+                                            FILE_ATTRIBUTE_NORMAL,
+                                            NULL);
+    if (std::get<void *>(lockHandle) == INVALID_HANDLE_VALUE) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open pack lock file failed! error code: %lu\n", NEO::SysCalls::getProcessId(), SysCalls::getLastError());
+        return false;
+    }
+
+    OVERLAPPED overlapped = {0};
+    if (!NEO::SysCalls::lockFileEx(std::get<void *>(lockHandle), LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock pack lock file failed! error code: %lu\n", NEO::SysCalls::getProcessId(), SysCalls::getLastError());
+        NEO::SysCalls::closeHandle(std::get<void *>(lockHandle));
+        lockHandle = INVALID_HANDLE_VALUE;
+        return false;
+    }
+    return true;
+}
+
+void CompilerCachePack::unlockPackFile(UnifiedHandle &lockHandle) {
+    OVERLAPPED overlapped = {0};
+    NEO::SysCalls::unlockFileEx(std::get<void *>(lockHandle), 0, MAXDWORD, MAXDWORD, &overlapped);
+    NEO::SysCalls::closeHandle(std::get<void *>(lockHandle));
+    lockHandle = INVALID_HANDLE_VALUE;
+}
+
+bool CompilerCachePack::renameTempFileToPackFile() {
+    if (!NEO::SysCalls::moveFileExA(tempFilePath.c_str(), packFilePath.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Rename pack temp file failed! error code: %lu\n", NEO::SysCalls::getProcessId(), SysCalls::getLastError());
+        return false;
+    }
+    return true;
+}
+
+void CompilerCachePack::removeTempFile() {
+    NEO::SysCalls::deleteFileA(tempFilePath.c_str());
+}
+
+} // namespace NEO
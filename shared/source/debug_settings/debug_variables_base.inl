@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -160,6 +160,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceThreadGroupDispatchSize, -1, "Set ThreadGro
 DECLARE_DEBUG_VARIABLE(int32_t, ForceStatelessL1CachingPolicy, -1, "-1: default, >=0 : program value for stateless L1 caching")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceMemoryBankIndexOverride, -1, "-1: default, 0: disable, 1:enable, Force index=1 of memory bank for XEHP")
 DECLARE_DEBUG_VARIABLE(int32_t, EnablePrivateScratchSlot1, -1, "-1: default, 0: disable, 1: enable Allows using private scratch space")
+DECLARE_DEBUG_VARIABLE(int32_t, ScratchSpaceIdleReleaseTimeoutInMilliseconds, -1, "-1: default (disabled), >=0: release scratch space of idle engine when no scratch was required for given number of milliseconds, each engine releases its own scratch space, not applied in heapless mode")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDevicePrivateMemoryReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled. Private surfaces allocated per dispatch are returned to device pool on command list reset or destroy and reused by other command lists")
 DECLARE_DEBUG_VARIABLE(int32_t, DisablePipeControlPrecedingPostSyncCommand, -1, "-1 default - disabled adding PIPE_CONTROL, 0 - disabled adding PIPE_CONTROL, 1 - enabled adding PIPE_CONTROL")
 DECLARE_DEBUG_VARIABLE(int32_t, FormatForStatelessCompressionWithUnifiedMemory, 0xF, "Format for stateless compression with unified memory")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceMultiGpuPartialWrites, -1, "-1: default - 0 for multiOsContext capable, 0: program value 0 in MultiGpuPartialWrites controls 1: program value 1 in MultiGpuPartialWrites controls")
@@ -238,6 +240,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, ReadBackCommandBufferAllocation, -1, "Read comma
 DECLARE_DEBUG_VARIABLE(int32_t, UseContextEndOffsetForEventCompletion, -1, "Use Context End or Context Start for event completion signalling. -1: default: platform dependent, 0 - Use Context Start, 1 - Use Context End")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceWddmLowPriorityContextValue, -1, "Force scheduling priority value during Wddm low priority context creation. -1 - default.")
 DECLARE_DEBUG_VARIABLE(int32_t, FailBuildProgramWithStatefulAccess, -1, "-1: default, 0: disable, 1: enable, Fail build program/module creation whenever stateful access is discovered (except built in kernels).")
+DECLARE_DEBUG_VARIABLE(int32_t, ModuleBuildWorkerThreads, -1, "-1: default (disabled), 0: disabled, >0: number of driver threads building user modules in background. zeModuleCreate returns before the build completes, module calls wait for its own build and report build failures")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelIsaUpload, -1, "-1: default (disabled), 0: disabled, 1: enabled. ISA of kernels placed in their own allocations is copied to them on first kernel creation or function pointer query instead of module creation, allocations are still created with the module")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIsaPoolSizeClasses, -1, "-1: default (enabled), 0: disabled, 1: enabled. ISA requests smaller than a page are served from separate ISA pools with finer chunk alignment")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelKernelDecodeThreads, -1, "-1: default (disabled), 0: disabled, >0: max number of threads decoding zebin kernels and patching relocations of kernel ISA segments. Results do not depend on the number of threads")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceImagesSupport, -1, "-1: default, 0: disable, 1: enable. Override support for Images.")
 DECLARE_DEBUG_VARIABLE(int32_t, RemoveUserFenceInCmdlistResetAndDestroy, -1, "-1: default - disabled, 0: disable, 1: enable. If enabled remove user fence during cmdlist reset and destroy.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCmdListCmdBufferSizeInKb, -1, "-1: default, 0: disable, >0: size in KB. Override cmd list command buffer size in KB.")
@@ -332,6 +338,7 @@ DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs d
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver chosen local workgroup sizes")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch parameters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
+DECLARE_DEBUG_VARIABLE(bool, PrintDeviceStartupTime, false, "prints execution time of each root device initialization phase")
 DECLARE_DEBUG_VARIABLE(bool, PrintRelocations, false, "prints relocations debug information")
 DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all timestamps values during profiling data calculation")
 DECLARE_DEBUG_VARIABLE(bool, PrintCalculatedTimestamps, false, "prints final l0 timestamps values for profiling data calculation")
@@ -345,6 +352,11 @@ DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbo
 DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispatch details")
 DECLARE_DEBUG_VARIABLE(bool, PrintKmdTimes, false, "Print ioctl times")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called")
+DECLARE_DEBUG_VARIABLE(bool, PrintBindlessHeapsOccupancy, false, "Print bindless heaps occupancy and slot reuse counters at bindless heaps helper destruction")
+DECLARE_DEBUG_VARIABLE(bool, PrintScratchSpaceHighWaterMark, false, "Print the largest scratch space size allocated by each scratch space controller at its destruction")
+DECLARE_DEBUG_VARIABLE(bool, PrintCompilerCacheStatistics, false, "Print compiler cache hit, miss and loaded byte counters of memory and disk tiers at compiler cache destruction")
+DECLARE_DEBUG_VARIABLE(bool, PrintIsaPoolStatistics, false, "Print ISA pool count, fill ratio and fragmentation of free pool memory at device destruction")
+DECLARE_DEBUG_VARIABLE(bool, PrintStateCommandStatistics, false, "Print number of emitted and elided state commands per engine at command stream receiver destruction")
 DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message when shared allocation is being migrated by UMD")
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
@@ -356,6 +368,8 @@ DECLARE_DEBUG_VARIABLE(bool, PrintCpuFlags, false, "Print CPU Flags and properti
 DECLARE_DEBUG_VARIABLE(int32_t, PrintL0MetricLogs, 0, "L0 Metrics logs mask. 0 - Disabled, 1 - ERROR, 3 - INFO, 7 - DEBUG")
 DECLARE_DEBUG_VARIABLE(bool, PrintL0SetKernelArg, false, "Print L0 Set Kernel Arg data")
 DECLARE_DEBUG_VARIABLE(bool, LogIndirectDetectionKernelDetails, false, "Log information for indirect detection for each kernel")
+DECLARE_DEBUG_VARIABLE(std::string, PerfProfilerTraceFile, std::string("unk"), "When set, PerfProfiler records api and system times to per-thread ring buffers flushed in background to given Chrome trace (JSON) file instead of XML reports")
+DECLARE_DEBUG_VARIABLE(int32_t, PerfProfilerTraceBufferSize, -1, "Number of events in per-thread PerfProfiler trace ring buffer, -1: default (65536)")
 
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -648,6 +662,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, UpdateTaskCountFromWait, -1, " Do not update tas
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWaitForQueues, -1, "Wait on queues using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpu engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWaitForEvents, -1, "Wait on events using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpu engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default, 0: create all contexts immediately, 1: defer, if possible")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferEngineResourcesCreation, -1, "-1: default(disabled), 0: disabled, 1: create global fence and preemption allocations of engines with deferred context initialization on first use")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelRootDeviceInitialization, -1, "-1: default(disabled), 0: disabled, 1: initialize OS interfaces of root devices on worker threads")
 DECLARE_DEBUG_VARIABLE(int32_t, UsmInitialPlacement, -1, "-1: default, 0: optimize for first CPU access, 1: optimize for first GPU access")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceHostPointerImport, -1, "-1: default, 0: disable, 1: enable, Forces the driver to import every host pointer coming into driver, WARNING this is not spec compliant.")
 DECLARE_DEBUG_VARIABLE(int32_t, ProgramExtendedPipeControlPriorToNonPipelinedStateCommand, -1, "-1: default, 0: disable, 1: enable, Program additional extended version of PIPE CONTROL command before non pipelined state command")
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,6 +67,9 @@ Device::~Device() {
     subdevices.clear();
 
     syncBufferHandler.reset();
+    if (debugManager.flags.PrintIsaPoolStatistics.get()) {
+        isaPoolAllocator.printStatistics();
+    }
     isaPoolAllocator.releasePools();
     if (deviceUsmMemAllocPoolsManager) {
         deviceUsmMemAllocPoolsManager->cleanup();
@@ -471,7 +474,8 @@ bool Device::createEngine(EngineTypeUsage engineTypeUsage) {
 
     commandStreamReceiver->setupContext(*osContext);
 
-    if (osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
+    const bool immediateContextInitialization = osContext->isImmediateContextInitializationEnabled(isDefaultEngine);
+    if (immediateContextInitialization) {
         if (!commandStreamReceiver->initializeResources(false)) {
             return false;
         }
@@ -481,11 +485,11 @@ bool Device::createEngine(EngineTypeUsage engineTypeUsage) {
         return false;
     }
 
-    if (!commandStreamReceiver->createGlobalFenceAllocation()) {
-        return false;
-    }
-
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
+    if (!immediateContextInitialization && debugManager.flags.DeferEngineResourcesCreation.get() == 1) {
+        // created together with the os context in CommandStreamReceiver::initializeResources;
+        // csr, os context and tag allocation stay eager as context ids are assigned sequentially and tag addresses are read for every registered engine
+        commandStreamReceiver->deferEngineResourcesCreation();
+    } else if (!commandStreamReceiver->createEngineResources()) {
         return false;
     }
 
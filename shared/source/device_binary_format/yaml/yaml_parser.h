@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <cstdint>
 #include <iterator>
 #include <string>
 
@@ -73,6 +74,28 @@ constexpr bool isSign(char c) {
     return ('+' == c) || ('-' == c);
 }
 
+namespace CharacterClass {
+constexpr uint8_t nameIdentifier = 1U << 0;
+constexpr uint8_t separationWhitespace = 1U << 1;
+} // namespace CharacterClass
+
+// precomputed classes of all characters, so that tokenizer's inner loops need a single lookup per character
+constexpr std::array<uint8_t, 256> createCharacterClassTable() {
+    std::array<uint8_t, 256> table{};
+    for (uint32_t c = 0; c < table.size(); ++c) {
+        auto character = static_cast<char>(c);
+        table[c] = (isNameIdentifierCharacter(character) ? CharacterClass::nameIdentifier : 0U) |
+                   (isSeparationWhitespace(character) ? CharacterClass::separationWhitespace : 0U);
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> characterClassTable = createCharacterClassTable();
+
+constexpr bool hasCharacterClass(char c, uint8_t characterClass) {
+    return 0 != (characterClassTable[static_cast<uint8_t>(c)] & characterClass);
+}
+
 inline bool isSpecificNameIdentifier(ConstStringRef wholeText, const char *parsePos, ConstStringRef pattern) {
     UNRECOVERABLE_IF(parsePos < wholeText.begin());
     bool hasEnoughText = (reinterpret_cast<uintptr_t>(parsePos) + pattern.size() <= reinterpret_cast<uintptr_t>(wholeText.end()));
@@ -129,12 +152,7 @@ constexpr const char *consumeNameIdentifier(ConstStringRef wholeText, const char
     auto parseEnd = wholeText.end();
     if (isNameIdentifierBeginningCharacter(*parsePos)) {
         auto it = parsePos + 1;
-        while (it < parseEnd) {
-            if (false == isNameIdentifierCharacter(*it)) {
-                if (false == isSeparationWhitespace(*it)) {
-                    break;
-                }
-            }
+        while ((it < parseEnd) && hasCharacterClass(*it, CharacterClass::nameIdentifier | CharacterClass::separationWhitespace)) {
             ++it;
         }
         return it;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_for.h"
 
 namespace NEO::Zebin::ZeInfo {
 
@@ -505,9 +506,49 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
     return DecodeError::success;
 }
 
+DecodeError decodeZeInfoKernelsInParallel(ProgramInfo &dst, Yaml::YamlParser &parser, const Yaml::Node &kernelsNd, uint32_t maxThreads, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
+    struct KernelDecodeResult {
+        std::unique_ptr<KernelInfo> kernelInfo = std::make_unique<KernelInfo>();
+        DecodeError error = DecodeError::success;
+        std::string errReason;
+        std::string warning;
+    };
+
+    std::vector<const Yaml::Node *> kernelNodes;
+    kernelNodes.reserve(kernelsNd.numChildren);
+    for (const auto &kernelNd : parser.createChildrenRange(kernelsNd)) {
+        kernelNodes.push_back(&kernelNd);
+    }
+
+    std::vector<KernelDecodeResult> results(kernelNodes.size());
+    parallelFor(dst.workerPool, kernelNodes.size(), maxThreads, [&](size_t kernelId) {
+        auto &result = results[kernelId];
+        result.error = decodeZeInfoKernelEntry(result.kernelInfo->kernelDescriptor, parser, *kernelNodes[kernelId], dst.grfSize, dst.minScratchSpaceSize, result.errReason, result.warning, srcZeInfoVersion);
+    });
+
+    // merged in order of kernels, so that output is the same as with sequential decoding
+    for (auto &result : results) {
+        outErrReason.append(result.errReason);
+        outWarning.append(result.warning);
+        if (DecodeError::success != result.error) {
+            return result.error;
+        }
+        dst.kernelInfos.push_back(result.kernelInfo.release());
+    }
+    return DecodeError::success;
+}
+
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
     UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
-    for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+    const auto &kernelsNd = *zeInfoSections.kernels[0];
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelsNd.numChildren);
+
+    const auto parallelDecodeThreads = NEO::debugManager.flags.ParallelKernelDecodeThreads.get();
+    if ((parallelDecodeThreads > 1) && (kernelsNd.numChildren >= minKernelsCountForParallelDecode) && (dst.workerPool != nullptr)) {
+        return decodeZeInfoKernelsInParallel(dst, parser, kernelsNd, static_cast<uint32_t>(parallelDecodeThreads), outErrReason, outWarning, srcZeInfoVersion);
+    }
+
+    for (const auto &kernelNd : parser.createChildrenRange(kernelsNd)) {
         auto kernelInfo = std::make_unique<KernelInfo>();
         auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning, srcZeInfoVersion);
         if (DecodeError::success != zeInfoErr) {
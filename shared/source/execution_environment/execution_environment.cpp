@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -25,10 +26,14 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/hot_path_counters.h"
 #include "shared/source/utilities/wait_util.h"
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
 
 namespace NEO {
-ExecutionEnvironment::ExecutionEnvironment() {
+ExecutionEnvironment::ExecutionEnvironment() : compiledBuiltinsCache(std::make_unique<CompiledBuiltinsCache>()) {
     WaitUtils::init();
     this->configureNeoEnvironment();
 }
@@ -59,6 +64,35 @@ ExecutionEnvironment::~ExecutionEnvironment() {
     rootDeviceEnvironments.clear();
     mapOfSubDeviceIndices.clear();
     this->restoreCcsMode();
+    if (debugManager.flags.PrintHotPathCounters.get()) {
+        HotPathCounters::print(stdout);
+    }
+}
+
+CompilerCacheMemoryTier *ExecutionEnvironment::getCompilerCacheMemoryTier(size_t maxSize) {
+    std::lock_guard<std::mutex> lock(compilerCacheMemoryTierMutex);
+    if (compilerCacheMemoryTier == nullptr) {
+        compilerCacheMemoryTier = std::make_unique<CompilerCacheMemoryTier>(maxSize);
+    }
+    return compilerCacheMemoryTier.get();
+}
+
+WorkerPool *ExecutionEnvironment::getWorkerPool() {
+    std::lock_guard<std::mutex> lock(workerPoolMutex);
+    if (workerPool == nullptr) {
+        // calling thread takes part in parallel work, so one hardware thread is left for it
+        const auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        workerPool = std::make_unique<WorkerPool>(hardwareThreads - 1);
+    }
+    return workerPool.get();
+}
+
+WorkerPool *ExecutionEnvironment::getKernelDecodeWorkerPool() {
+    // worker threads are not created for programs decoded sequentially
+    if (debugManager.flags.ParallelKernelDecodeThreads.get() <= 1) {
+        return nullptr;
+    }
+    return getWorkerPool();
 }
 
 bool ExecutionEnvironment::initializeMemoryManager() {
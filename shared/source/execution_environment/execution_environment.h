@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,11 +17,14 @@
 #include <vector>
 
 namespace NEO {
+class CompiledBuiltinsCache;
+class CompilerCacheMemoryTier;
 class DirectSubmissionController;
 class GfxCoreHelper;
 class MemoryManager;
 struct OsEnvironment;
 struct RootDeviceEnvironment;
+class WorkerPool;
 
 class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment> {
 
@@ -68,10 +71,14 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    CompilerCacheMemoryTier *getCompilerCacheMemoryTier(size_t maxSize);
+    WorkerPool *getWorkerPool();
+    WorkerPool *getKernelDecodeWorkerPool();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
     std::unique_ptr<OsEnvironment> osEnvironment;
+    std::unique_ptr<CompiledBuiltinsCache> compiledBuiltinsCache;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
     // Map of Sub Device Indicies set during Affinity Mask in the form of:
@@ -95,6 +102,10 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     DebuggingMode debuggingEnabledMode = DebuggingMode::disabled;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
+    std::unique_ptr<CompilerCacheMemoryTier> compilerCacheMemoryTier;
+    std::mutex compilerCacheMemoryTierMutex;
+    std::unique_ptr<WorkerPool> workerPool;
+    std::mutex workerPoolMutex;
     std::vector<std::tuple<std::string, uint32_t>> deviceCcsModeVec;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,8 @@
 #include "shared/source/release_helper/release_helper.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
+#include <mutex>
+
 namespace NEO {
 
 RootDeviceEnvironment::RootDeviceEnvironment(ExecutionEnvironment &executionEnvironment) : executionEnvironment(executionEnvironment) {
@@ -120,6 +122,9 @@ bool RootDeviceEnvironment::initAilConfiguration() {
 
 void RootDeviceEnvironment::initGmm() {
     if (!gmmHelper) {
+        // gmm library state is process wide while root device environments may be initialized concurrently
+        static std::mutex gmmInitializationMutex;
+        std::lock_guard<std::mutex> lock(gmmInitializationMutex);
         gmmHelper.reset(new GmmHelper(*this));
     }
 }
@@ -148,7 +153,14 @@ CompilerInterface *RootDeviceEnvironment::getCompilerInterface() {
     if (this->compilerInterface.get() == nullptr) {
         std::lock_guard<std::mutex> autolock(this->mtx);
         if (this->compilerInterface.get() == nullptr) {
-            auto cache = std::make_unique<CompilerCache>(getDefaultCompilerCacheConfig());
+            auto cacheConfig = getDefaultCompilerCacheConfig();
+            auto cache = std::make_unique<CompilerCache>(cacheConfig);
+            if (cacheConfig.memoryCacheSize > 0) {
+                cache->setMemoryTier(executionEnvironment.getCompilerCacheMemoryTier(cacheConfig.memoryCacheSize));
+            }
+            if (cacheConfig.compressionEnabled) {
+                cache->setWorkerPool(executionEnvironment.getWorkerPool());
+            }
             this->compilerInterface.reset(CompilerInterface::createInstance(std::move(cache), ApiSpecificConfig::getApiType() == ApiSpecificConfig::ApiType::OCL));
         }
     }
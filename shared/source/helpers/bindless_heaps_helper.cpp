@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/bindless_heaps_helper.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -128,6 +129,12 @@ bool BindlessHeapsHelper::initializeReservedMemory() {
 }
 
 BindlessHeapsHelper::~BindlessHeapsHelper() {
+    if (debugManager.flags.PrintBindlessHeapsOccupancy.get()) {
+        auto occupancy = getHeapsOccupancy();
+        printf("Bindless heaps occupancy for root device %u: allocated %zu, used %zu, in reuse pools %zu, reused slots %llu, split slots %llu\n",
+               rootDeviceIndex, occupancy.heapsAllocatedSize, occupancy.heapsUsedSize, occupancy.reusePoolsSize,
+               static_cast<unsigned long long>(occupancy.reusedSlotsCount), static_cast<unsigned long long>(occupancy.splitSlotsCount));
+    }
     for (auto *allocation : ssHeapsAllocations) {
         memManager->freeGraphicsMemory(allocation);
     }
@@ -223,8 +230,15 @@ SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, Grap
                     surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].clear();
                 }
 
+                reusedSlotsCount++;
                 return surfaceStateFromVector;
             }
+
+            SurfaceStateInHeapInfo surfaceStateFromSplit = {};
+            if (index == 0 && trySplittingReusedSlots(surfaceStateFromSplit)) {
+                reusedSlotsCount++;
+                return surfaceStateFromSplit;
+            }
         }
     }
 
@@ -241,6 +255,30 @@ SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, Grap
     return bindlesInfo;
 }
 
+bool BindlessHeapsHelper::trySplittingReusedSlots(SurfaceStateInHeapInfo &surfaceStateInfo) {
+    auto &singleSlotsReuse = surfaceStateInHeapVectorReuse[allocatePoolIndex][0];
+    auto &imageSlotsReuse = surfaceStateInHeapVectorReuse[allocatePoolIndex][1];
+
+    if (!singleSlotsReuse.empty() || imageSlotsReuse.empty()) {
+        return false;
+    }
+
+    // carve a released image slot range into single surface state slots instead of growing the heap
+    auto imageSlots = imageSlotsReuse.back();
+    imageSlotsReuse.pop_back();
+
+    for (uint32_t slot = NEO::BindlessImageSlot::max - 1; slot > 0; slot--) {
+        singleSlotsReuse.push_back({imageSlots.heapAllocation,
+                                    imageSlots.surfaceStateOffset + slot * surfaceStateSize,
+                                    ptrOffset(imageSlots.ssPtr, slot * surfaceStateSize),
+                                    surfaceStateSize});
+    }
+    splitSlotsCount++;
+
+    surfaceStateInfo = {imageSlots.heapAllocation, imageSlots.surfaceStateOffset, imageSlots.ssPtr, surfaceStateSize};
+    return true;
+}
+
 void *BindlessHeapsHelper::getSpaceInHeap(size_t ssSize, BindlesHeapType heapType) {
     auto heap = surfaceStateHeaps[heapType].get();
     if (heap->getAvailableSpace() < ssSize) {
@@ -275,6 +313,7 @@ bool BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
         return false;
     }
     ssHeapsAllocations.push_back(newAlloc);
+    retiredHeapsUsedSize += heap->getUsed();
     heap->replaceGraphicsAllocation(newAlloc);
     heap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                         newAlloc->getUnderlyingBufferSize());
@@ -291,4 +330,30 @@ void BindlessHeapsHelper::releaseSSToReusePool(const SurfaceStateInHeapInfo &sur
     return;
 }
 
-} // namespace NEO
\ No newline at end of file
+BindlessHeapsOccupancy BindlessHeapsHelper::getHeapsOccupancy() {
+    std::lock_guard<std::mutex> autolock(this->mtx);
+
+    BindlessHeapsOccupancy occupancy{};
+    for (auto *allocation : ssHeapsAllocations) {
+        occupancy.heapsAllocatedSize += allocation->getUnderlyingBufferSize();
+    }
+
+    occupancy.heapsUsedSize = retiredHeapsUsedSize;
+    for (const auto &heap : surfaceStateHeaps) {
+        occupancy.heapsUsedSize += heap->getUsed();
+    }
+
+    for (const auto &pool : surfaceStateInHeapVectorReuse) {
+        for (const auto &sizeClassSlots : pool) {
+            for (const auto &slot : sizeClassSlots) {
+                occupancy.reusePoolsSize += slot.ssSize;
+            }
+        }
+    }
+
+    occupancy.reusedSlotsCount = reusedSlotsCount;
+    occupancy.splitSlotsCount = splitSlotsCount;
+    return occupancy;
+}
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,14 @@ constexpr uint32_t redescribedImage = 3;
 constexpr uint32_t max = 4;
 }; // namespace BindlessImageSlot
 
+struct BindlessHeapsOccupancy {
+    size_t heapsAllocatedSize = 0;
+    size_t heapsUsedSize = 0;
+    size_t reusePoolsSize = 0;
+    uint64_t reusedSlotsCount = 0;
+    uint64_t splitSlotsCount = 0;
+};
+
 class BindlessHeapsHelper {
   public:
     enum BindlesHeapType {
@@ -70,12 +78,14 @@ class BindlessHeapsHelper {
     }
     bool getStateDirtyForContext(uint32_t osContextId);
     void clearStateDirtyForContext(uint32_t osContextId);
+    BindlessHeapsOccupancy getHeapsOccupancy();
 
   protected:
     bool tryReservingMemoryForSpecialSsh(const size_t size, size_t alignment);
     std::optional<AddressRange> reserveMemoryRange(size_t size, size_t alignment, HeapIndex heapIndex);
     bool initializeReservedMemory();
     bool isReservedMemoryModeAvailable();
+    bool trySplittingReusedSlots(SurfaceStateInHeapInfo &surfaceStateInfo);
 
   protected:
     Device *rootDevice = nullptr;
@@ -92,6 +102,9 @@ class BindlessHeapsHelper {
     uint32_t allocatePoolIndex = 0;
     uint32_t releasePoolIndex = 0;
     bool allocateFromReusePool = false;
+    size_t retiredHeapsUsedSize = 0;
+    uint64_t reusedSlotsCount = 0;
+    uint64_t splitSlotsCount = 0;
     std::array<std::vector<SurfaceStateInHeapInfo>, 2> surfaceStateInHeapVectorReuse[2];
     std::bitset<64> stateCacheDirtyForContext;
 
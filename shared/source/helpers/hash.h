@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 // clang-format off
@@ -104,6 +105,140 @@ class Hash {
     uint32_t a, hi, lo;
 };
 
+// 64-bit hash consuming 32-byte stripes in four independent lanes (XXH64 algorithm).
+// Lanes have no dependencies between each other, so compilers can keep them in wide registers.
+class WideHash {
+  public:
+    WideHash() {
+        reset();
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr || size == 0) {
+            return;
+        }
+        auto input = reinterpret_cast<const uint8_t *>(buff);
+        totalSize += size;
+
+        if (bufferedSize + size < stripeSize) {
+            memcpy(buffer + bufferedSize, input, size);
+            bufferedSize += size;
+            return;
+        }
+
+        if (bufferedSize > 0) {
+            const auto toFill = stripeSize - bufferedSize;
+            memcpy(buffer + bufferedSize, input, toFill);
+            consumeStripe(buffer);
+            input += toFill;
+            size -= toFill;
+            bufferedSize = 0;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(input);
+            input += stripeSize;
+            size -= stripeSize;
+        }
+
+        memcpy(buffer, input, size);
+        bufferedSize = size;
+    }
+
+    uint64_t finish() const {
+        uint64_t result = 0;
+        if (totalSize >= stripeSize) {
+            result = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+            for (const auto lane : lanes) {
+                result ^= round(0, lane);
+                result = result * prime1 + prime4;
+            }
+        } else {
+            result = prime5;
+        }
+        result += totalSize;
+
+        const uint8_t *tail = buffer;
+        size_t tailSize = bufferedSize;
+        while (tailSize >= sizeof(uint64_t)) {
+            result ^= round(0, read<uint64_t>(tail));
+            result = rotl(result, 27) * prime1 + prime4;
+            tail += sizeof(uint64_t);
+            tailSize -= sizeof(uint64_t);
+        }
+        if (tailSize >= sizeof(uint32_t)) {
+            result ^= static_cast<uint64_t>(read<uint32_t>(tail)) * prime1;
+            result = rotl(result, 23) * prime2 + prime3;
+            tail += sizeof(uint32_t);
+            tailSize -= sizeof(uint32_t);
+        }
+        while (tailSize > 0) {
+            result ^= (*tail) * prime5;
+            result = rotl(result, 11) * prime1;
+            tail++;
+            tailSize--;
+        }
+
+        result ^= result >> 33;
+        result *= prime2;
+        result ^= result >> 29;
+        result *= prime3;
+        result ^= result >> 32;
+        return result;
+    }
+
+    void reset() {
+        lanes[0] = prime1 + prime2;
+        lanes[1] = prime2;
+        lanes[2] = 0;
+        lanes[3] = 0 - prime1;
+        totalSize = 0;
+        bufferedSize = 0;
+    }
+
+    static uint64_t hash(const char *buff, size_t size) {
+        WideHash hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static constexpr size_t stripeSize = 32u;
+    static constexpr uint64_t prime1 = 0x9e3779b185ebca87ull;
+    static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4full;
+    static constexpr uint64_t prime3 = 0x165667b19e3779f9ull;
+    static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ull;
+    static constexpr uint64_t prime5 = 0x27d4eb2f165667c5ull;
+
+    static uint64_t rotl(uint64_t value, uint32_t shift) {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+    static uint64_t round(uint64_t accumulator, uint64_t input) {
+        accumulator += input * prime2;
+        accumulator = rotl(accumulator, 31);
+        return accumulator * prime1;
+    }
+
+    template <typename T>
+    static T read(const uint8_t *ptr) {
+        T value;
+        memcpy(&value, ptr, sizeof(T));
+        return value;
+    }
+
+    void consumeStripe(const uint8_t *stripe) {
+        for (size_t lane = 0; lane < 4; lane++) {
+            lanes[lane] = round(lanes[lane], read<uint64_t>(stripe + lane * sizeof(uint64_t)));
+        }
+    }
+
+    uint64_t lanes[4];
+    uint64_t totalSize;
+    size_t bufferedSize;
+    uint8_t buffer[stripeSize];
+};
+
 template <typename T>
 uint32_t hashPtrToU32(const T *src) {
     auto asInt = reinterpret_cast<uintptr_t>(src);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/hot_path_counters.h"
 
 namespace NEO {
 
@@ -101,8 +102,10 @@ void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t requestedSize, const
         auto actualSize = requestedSize;
         auto pooledAddress = this->chunkAllocator->allocateWithCustomAlignment(actualSize, memoryProperties.alignment);
         if (!pooledAddress) {
+            HotPathCounters::increment(HotPathCounters::usmPoolMiss);
             return nullptr;
         }
+        HotPathCounters::increment(HotPathCounters::usmPoolHit);
 
         pooledPtr = addrToPtr(pooledAddress);
         this->allocations.insert(pooledPtr, AllocationInfo{pooledAddress, actualSize, requestedSize});
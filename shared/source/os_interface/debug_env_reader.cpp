@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/utilities/io_functions.h"
 
+#include <cstring>
 #include <vector>
 
 namespace NEO {
@@ -36,16 +37,14 @@ int32_t EnvironmentVariableReader::getSetting(const char *settingName, int32_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue, DebugVarPrefix &type) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
-    auto prefixString = ApiSpecificConfig::getPrefixStrings();
-    auto prefixType = ApiSpecificConfig::getPrefixTypes();
+    const auto &prefixString = ApiSpecificConfig::getPrefixStrings();
+    const auto &prefixType = ApiSpecificConfig::getPrefixTypes();
     uint32_t i = 0;
 
     for (const auto &prefix : prefixString) {
-        std::string neoKey = prefix;
-        neoKey += settingName;
-        envValue = IoFunctions::getenvPtr(neoKey.c_str());
+        envValue = getEnvironmentValue(prefix, settingName);
         if (envValue) {
             value = atoll(envValue);
             type = prefixType[i];
@@ -59,9 +58,9 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvironmentValue("", settingName);
     if (envValue) {
         value = atoll(envValue);
     }
@@ -69,18 +68,16 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
-    auto prefixString = ApiSpecificConfig::getPrefixStrings();
-    auto prefixType = ApiSpecificConfig::getPrefixTypes();
+    const auto &prefixString = ApiSpecificConfig::getPrefixStrings();
+    const auto &prefixType = ApiSpecificConfig::getPrefixTypes();
 
     uint32_t i = 0;
     for (const auto &prefix : prefixString) {
-        std::string neoKey = prefix;
-        neoKey += settingName;
-        envValue = IoFunctions::getenvPtr(neoKey.c_str());
+        envValue = getEnvironmentValue(prefix, settingName);
         if (envValue) {
             keyValue.assign(envValue);
             type = prefixType[i];
@@ -93,14 +90,53 @@ std::string EnvironmentVariableReader::getSetting(const char *settingName, const
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvironmentValue("", settingName);
     if (envValue) {
         keyValue.assign(envValue);
     }
     return keyValue;
 }
+
+const char *EnvironmentVariableReader::getEnvironmentValue(const char *prefix, const char *settingName) {
+    if (prefix[0] == '\0') {
+        return IoFunctions::getenvPtr(settingName);
+    }
+    std::string neoKey = prefix;
+    neoKey += settingName;
+    return IoFunctions::getenvPtr(neoKey.c_str());
+}
+
+EnvironmentSnapshotReader::EnvironmentSnapshotReader(const char *const *environment) {
+    if (environment == nullptr) {
+        return;
+    }
+    for (auto entry = environment; *entry != nullptr; entry++) {
+        auto separator = strchr(*entry, '=');
+        if (separator == nullptr) {
+            continue;
+        }
+        std::string name(*entry, separator - *entry);
+        if (strncmp(name.c_str(), "NEO_", 4) == 0) {
+            prefixedVariablesPresent = true;
+        }
+        variables.emplace(std::move(name), separator + 1);
+    }
+}
+
+const char *EnvironmentSnapshotReader::getEnvironmentValue(const char *prefix, const char *settingName) {
+    if (prefix[0] != '\0' && !prefixedVariablesPresent) {
+        return nullptr;
+    }
+    lookupKey.assign(prefix);
+    lookupKey.append(settingName);
+    auto it = variables.find(lookupKey);
+    if (it == variables.end()) {
+        return nullptr;
+    }
+    return it->second.c_str();
+}
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,9 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
+#include <string>
+#include <unordered_map>
+
 namespace NEO {
 
 class EnvironmentVariableReader : public SettingsReader {
@@ -23,5 +26,25 @@ class EnvironmentVariableReader : public SettingsReader {
     std::string getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) override;
     std::string getSetting(const char *settingName, const std::string &value) override;
     const char *appSpecificLocation(const std::string &name) override;
+
+  protected:
+    virtual const char *getEnvironmentValue(const char *prefix, const char *settingName);
+};
+
+// Reads settings from a copy of the environment taken at construction, so reading all debug variables
+// scans the environment once instead of once per variable and prefix.
+class EnvironmentSnapshotReader : public EnvironmentVariableReader {
+  public:
+    EnvironmentSnapshotReader(const char *const *environment);
+
+    size_t getVariablesCount() const { return variables.size(); }
+    bool arePrefixedVariablesPresent() const { return prefixedVariablesPresent; }
+
+  protected:
+    const char *getEnvironmentValue(const char *prefix, const char *settingName) override;
+
+    std::unordered_map<std::string, std::string> variables;
+    std::string lookupKey;
+    bool prefixedVariablesPresent = false;
 };
 } // namespace NEO
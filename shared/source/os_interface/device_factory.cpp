@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,16 +15,38 @@
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/product_config_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "hw_device_id.h"
 
+#include <chrono>
+
 namespace NEO {
 
+namespace {
+class StartupPhaseTimer : NonCopyableOrMovableClass {
+  public:
+    StartupPhaseTimer(const char *phaseName, uint32_t rootDeviceIndex)
+        : phaseName(phaseName), rootDeviceIndex(rootDeviceIndex), startTime(std::chrono::steady_clock::now()) {}
+
+    ~StartupPhaseTimer() {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+        DeviceFactory::startupPhaseCompletedFunc(phaseName, rootDeviceIndex, static_cast<uint64_t>(duration.count()));
+    }
+
+  protected:
+    const char *phaseName;
+    uint32_t rootDeviceIndex;
+    std::chrono::steady_clock::time_point startTime;
+};
+} // namespace
+
 bool DeviceFactory::prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment) {
     auto numRootDevices = 1u;
     if (debugManager.flags.CreateMultipleRootDevices.get()) {
@@ -157,12 +179,13 @@ bool DeviceFactory::isHwModeSelected() {
     }
 }
 
-static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
-                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
-    if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
-        return false;
-    }
+static bool initOsInterface(ExecutionEnvironment &executionEnvironment,
+                            std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
+    StartupPhaseTimer timer("initOsInterface", rootDeviceIndex);
+    return executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex);
+}
 
+static void initHwDeviceIdResourcesAfterOsInterface(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) {
     if (debugManager.flags.OverrideGpuAddressSpace.get() != -1) {
         executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
             maxNBitValue(static_cast<uint64_t>(debugManager.flags.OverrideGpuAddressSpace.get()));
@@ -181,8 +204,17 @@ static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
         executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->featureTable.regionCount = static_cast<uint32_t>(debugManager.flags.OverrideRegionCount.get());
     }
 
+    StartupPhaseTimer timer("initGmm", rootDeviceIndex);
     executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initGmm();
+}
 
+static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
+                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
+    if (!initOsInterface(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex)) {
+        return false;
+    }
+
+    initHwDeviceIdResourcesAfterOsInterface(executionEnvironment, rootDeviceIndex);
     return true;
 }
 
@@ -190,7 +222,11 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
     executionEnvironment.configureCcsMode();
 
     using HwDeviceIds = std::vector<std::unique_ptr<HwDeviceId>>;
-    HwDeviceIds hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    HwDeviceIds hwDeviceIds;
+    {
+        StartupPhaseTimer timer("discoverDevices", allRootDevices);
+        hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    }
     if (hwDeviceIds.empty()) {
         return false;
     }
@@ -199,12 +235,32 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
 
     uint32_t rootDeviceIndex = 0u;
 
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
-            continue;
+    if (debugManager.flags.ParallelRootDeviceInitialization.get() == 1 && hwDeviceIds.size() > 1) {
+        // each device is queried through its own environment; gmm initialization done by some OS interfaces is serialized in initGmm
+        std::vector<uint8_t> osInterfaceInitialized(hwDeviceIds.size(), false);
+        parallelFor(executionEnvironment.getWorkerPool(), hwDeviceIds.size(), static_cast<uint32_t>(hwDeviceIds.size()), [&](size_t hwDeviceIndex) {
+            osInterfaceInitialized[hwDeviceIndex] = initOsInterface(executionEnvironment, std::move(hwDeviceIds[hwDeviceIndex]), static_cast<uint32_t>(hwDeviceIndex));
+        });
+
+        // environments of failed devices are dropped, indices stored in OS interfaces are fixed in adjustRootDeviceEnvironments
+        for (size_t hwDeviceIndex = 0; hwDeviceIndex < hwDeviceIds.size(); hwDeviceIndex++) {
+            if (!osInterfaceInitialized[hwDeviceIndex]) {
+                continue;
+            }
+            if (rootDeviceIndex != hwDeviceIndex) {
+                executionEnvironment.rootDeviceEnvironments[rootDeviceIndex] = std::move(executionEnvironment.rootDeviceEnvironments[hwDeviceIndex]);
+            }
+            initHwDeviceIdResourcesAfterOsInterface(executionEnvironment, rootDeviceIndex);
+            rootDeviceIndex++;
         }
+    } else {
+        for (auto &hwDeviceId : hwDeviceIds) {
+            if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+                continue;
+            }
 
-        rootDeviceIndex++;
+            rootDeviceIndex++;
+        }
     }
 
     executionEnvironment.rootDeviceEnvironments.resize(rootDeviceIndex);
@@ -251,6 +307,7 @@ std::unique_ptr<Device> DeviceFactory::createDevice(ExecutionEnvironment &execut
 
     executionEnvironment.memoryManager->createDeviceSpecificMemResources(rootDeviceIndex);
     executionEnvironment.memoryManager->reInitLatestContextId();
+    StartupPhaseTimer timer("createRootDevice", rootDeviceIndex);
     device = createRootDeviceFunc(executionEnvironment, rootDeviceIndex);
 
     return device;
@@ -263,11 +320,15 @@ std::vector<std::unique_ptr<Device>> DeviceFactory::createDevices(ExecutionEnvir
         return devices;
     }
 
-    if (!DeviceFactory::createMemoryManagerFunc(executionEnvironment)) {
-        return devices;
+    {
+        StartupPhaseTimer timer("createMemoryManager", allRootDevices);
+        if (!DeviceFactory::createMemoryManagerFunc(executionEnvironment)) {
+            return devices;
+        }
     }
 
     for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < executionEnvironment.rootDeviceEnvironments.size(); rootDeviceIndex++) {
+        StartupPhaseTimer timer("createRootDevice", rootDeviceIndex);
         auto device = createRootDeviceFunc(executionEnvironment, rootDeviceIndex);
         if (device) {
             devices.push_back(std::move(device));
@@ -285,6 +346,14 @@ bool (*DeviceFactory::createMemoryManagerFunc)(ExecutionEnvironment &) = [](Exec
     return executionEnvironment.initializeMemoryManager();
 };
 
+void (*DeviceFactory::startupPhaseCompletedFunc)(const char *, uint32_t, uint64_t) = [](const char *phaseName, uint32_t rootDeviceIndex, uint64_t durationNs) -> void {
+    if (rootDeviceIndex == allRootDevices) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDeviceStartupTime.get(), stdout, "Device startup phase %s: %llu us\n", phaseName, static_cast<unsigned long long>(durationNs / 1000));
+    } else {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDeviceStartupTime.get(), stdout, "Device startup phase %s, root device %u: %llu us\n", phaseName, rootDeviceIndex, static_cast<unsigned long long>(durationNs / 1000));
+    }
+};
+
 bool DeviceFactory::isAllowedDeviceId(uint32_t deviceId, const std::string &deviceIdString) {
     if (deviceIdString != "unk") {
         char *endptr = nullptr;
@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,5 +32,9 @@ class DeviceFactory {
     static std::unique_ptr<Device> (*createRootDeviceFunc)(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
     static bool (*createMemoryManagerFunc)(ExecutionEnvironment &executionEnvironment);
     static bool isAllowedDeviceId(uint32_t deviceId, const std::string &deviceIdString);
+
+    // called after each device startup phase; rootDeviceIndex is allRootDevices for phases not bound to a single device
+    static constexpr uint32_t allRootDevices = std::numeric_limits<uint32_t>::max();
+    static void (*startupPhaseCompletedFunc)(const char *phaseName, uint32_t rootDeviceIndex, uint64_t durationNs);
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/hot_path_counters.h"
 
 namespace NEO {
 
@@ -257,6 +258,7 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::processResidency(Residency
     if (drm->isVmBindAvailable()) {
         return SubmissionStatus::success;
     }
+    HotPathCounters::increment(HotPathCounters::residencyListRebuild);
     int ret = 0;
     for (auto &alloc : inputAllocationsForResidency) {
         auto drmAlloc = static_cast<DrmAllocation *>(alloc);
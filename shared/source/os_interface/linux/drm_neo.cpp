@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
 #include "shared/source/helpers/gpu_page_fault_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/linux/cache_info.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
@@ -29,10 +30,12 @@
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/ioctl_latency_histograms.h"
 #include "shared/source/os_interface/linux/memory_info.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_inc.h"
@@ -45,6 +48,7 @@
 #include "shared/source/release_helper/release_helper.h"
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/directory.h"
+#include "shared/source/utilities/hot_path_counters.h"
 #include "shared/source/utilities/io_functions.h"
 
 #include <cstdio>
@@ -61,6 +65,9 @@ Drm::Drm(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceIdIn, RootDeviceEnvironment &r
       hwDeviceId(std::move(hwDeviceIdIn)), rootDeviceEnvironment(rootDeviceEnvironment) {
     pagingFence.fill(0u);
     fenceVal.fill(0u);
+    if (debugManager.flags.PrintIoctlLatencyHistograms.get()) {
+        ioctlLatencyHistograms = std::make_unique<IoctlLatencyHistograms>();
+    }
 }
 
 SubmissionStatus Drm::getSubmissionStatusFromReturnCode(int32_t retCode) {
@@ -88,8 +95,16 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
     auto requestValue = getIoctlRequestValue(request, ioctlHelper.get());
     int ret;
     int returnedErrno = 0;
+    uint32_t attempts = 0;
+    uint32_t interrupts = 0;
+    std::chrono::steady_clock::time_point callStart;
+    if (ioctlLatencyHistograms) {
+        callStart = std::chrono::steady_clock::now();
+    }
+    HotPathCounters::increment(HotPathCounters::drmIoctl);
     SYSTEM_ENTER();
     do {
+        attempts++;
         auto measureTime = debugManager.flags.PrintKmdTimes.get();
         std::chrono::steady_clock::time_point start;
         std::chrono::steady_clock::time_point end;
@@ -107,6 +122,9 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
 
         if (ret != 0) {
             returnedErrno = getErrno();
+            if (returnedErrno == EINTR) {
+                interrupts++;
+            }
         }
 
         if (measureTime) {
@@ -139,6 +157,10 @@ int Drm::ioctl(DrmIoctl request, void *arg) {
 
     } while (ret == -1 && checkIfIoctlReinvokeRequired(returnedErrno, request, ioctlHelper.get()));
     SYSTEM_LEAVE(request);
+    if (ioctlLatencyHistograms) {
+        auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - callStart).count();
+        ioctlLatencyHistograms->record(request, static_cast<uint64_t>(elapsedTime), attempts - 1, interrupts, ret != 0);
+    }
     return ret;
 }
 
@@ -738,6 +760,16 @@ std::string Drm::getDrmVersion(int fileDescriptor) {
 
 template <typename DataType>
 std::vector<DataType> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
+    // memory regions report unallocated sizes, so they are always queried from the kernel
+    const bool useQueryCache = queryCache && queryId != static_cast<uint32_t>(ioctlHelper->getDrmParamValue(DrmParam::queryMemoryRegions));
+    const void *cachedData = nullptr;
+    size_t cachedDataSize = 0;
+    if (useQueryCache && queryCache->find(queryId, queryItemFlags, cachedData, cachedDataSize)) {
+        auto data = std::vector<DataType>(Math::divideAndRoundUp(cachedDataSize, sizeof(DataType)), 0);
+        memcpy_s(data.data(), data.size() * sizeof(DataType), cachedData, cachedDataSize);
+        return data;
+    }
+
     Query query{};
     QueryItem queryItem{};
     queryItem.queryId = queryId;
@@ -758,6 +790,10 @@ std::vector<DataType> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
     if (ret != 0 || queryItem.length <= 0) {
         return {};
     }
+
+    if (useQueryCache) {
+        queryCache->store(queryId, queryItemFlags, data.data(), static_cast<size_t>(queryItem.length));
+    }
     return data;
 }
 
@@ -836,6 +872,9 @@ void Drm::cleanup() {
 
 Drm::~Drm() {
     this->printIoctlStatistics();
+    if (ioctlLatencyHistograms) {
+        ioctlLatencyHistograms->print(stdout, ioctlHelper.get());
+    }
 }
 
 int Drm::queryAdapterBDF() {
@@ -1034,6 +1073,27 @@ void Drm::setupCacheInfo(const HardwareInfo &hwInfo) {
     this->cacheInfo.reset(new CacheInfo(*ioctlHelper, maxReservationCacheSize, maxReservationNumCacheRegions, maxReservationNumWays));
 }
 
+void Drm::createQueryCache() {
+    const auto &platform = rootDeviceEnvironment.getHardwareInfo()->platform;
+    std::string prelimVersion = "";
+    getPrelimVersion(prelimVersion);
+
+    std::stringstream deviceKey;
+    deviceKey << "device:" << std::hex << platform.usDeviceID << "." << platform.usRevId << std::dec
+              << ";pci:" << hwDeviceId->getPciPath()
+              << ";kmd:" << getDrmVersion(getFileDescriptor()) << "." << prelimVersion;
+
+    this->queryCache = DrmQueryCache::create(hwDeviceId->getPciPath(), deviceKey.str());
+}
+
+void Drm::releaseQueryCache() {
+    // results of later queries, e.g. free memory of regions, are not static and must not be served from the snapshot
+    if (this->queryCache) {
+        this->queryCache->save();
+        this->queryCache.reset();
+    }
+}
+
 void Drm::getPrelimVersion(std::string &prelimVersion) {
     std::string sysFsPciPath = getSysFsPciPath();
     std::string prelimVersionPath = sysFsPciPath + "/prelim_uapi_version";
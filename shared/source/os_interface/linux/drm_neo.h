@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,8 @@ enum class SubmissionStatus : uint32_t;
 class BufferObject;
 class ReleaseHelper;
 class DeviceFactory;
+class DrmQueryCache;
+class IoctlLatencyHistograms;
 class MemoryInfo;
 class OsContext;
 class OsContextLinux;
@@ -281,6 +283,8 @@ class Drm : public DriverModel {
     void queryAndSetVmBindPatIndexProgrammingSupport();
     bool queryDeviceIdAndRevision();
     bool queryI915DeviceIdAndRevision();
+    void createQueryCache();
+    void releaseQueryCache();
     static uint64_t alignUpGttSize(uint64_t inputGttSize);
 
 #pragma pack(1)
@@ -334,6 +338,8 @@ class Drm : public DriverModel {
     std::unique_ptr<CacheInfo> cacheInfo;
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmQueryCache> queryCache;
+    std::unique_ptr<IoctlLatencyHistograms> ioctlLatencyHistograms;
 
     std::once_flag checkBindOnce;
     std::once_flag checkSetPairOnce;
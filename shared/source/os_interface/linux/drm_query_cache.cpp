@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+
+#include "shared/source/compiler_interface/os_compiler_cache_helper.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/neo_driver_version.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/debug_env_reader.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/mman.h>
+
+namespace NEO {
+
+const std::string neoDeviceQueryCache = "NEO_DEVICE_QUERY_CACHE";
+const std::string neoCacheDir = "NEO_CACHE_DIR";
+
+namespace {
+std::string readFirstLine(const char *path) {
+    std::string line;
+    std::ifstream ifs(path, std::ifstream::in);
+    if (!ifs.fail()) {
+        std::getline(ifs, line);
+    }
+    return line;
+}
+} // namespace
+
+std::unique_ptr<DrmQueryCache> DrmQueryCache::create(const std::string &pciPath, const std::string &deviceKey) {
+    EnvironmentVariableReader envReader;
+    if (!envReader.getSetting(neoDeviceQueryCache.c_str(), false)) {
+        return nullptr;
+    }
+
+    std::string emptyString = "";
+    auto cacheDir = envReader.getSetting(neoCacheDir.c_str(), emptyString);
+    if (cacheDir.empty()) {
+        if (!checkDefaultCacheDirSettings(cacheDir, envReader)) {
+            return nullptr;
+        }
+    } else if (!pathExists(cacheDir)) {
+        return nullptr;
+    }
+
+    // kernel release and boot id invalidate the snapshot on KMD update and on any hardware change requiring reboot
+    std::stringstream key;
+    key << deviceKey
+        << ";kernel:" << readFirstLine("/proc/sys/kernel/osrelease")
+        << ";boot:" << readFirstLine("/proc/sys/kernel/random/boot_id")
+        << ";driver:" << driverVersion;
+
+    std::stringstream fileName;
+    fileName << "drm_query_" << std::hex << std::setfill('0') << std::setw(16) << Hash::hash(pciPath.c_str(), pciPath.size()) << ".bin";
+
+    auto queryCache = std::make_unique<DrmQueryCache>(joinPath(cacheDir, fileName.str()), key.str());
+    queryCache->load();
+    return queryCache;
+}
+
+DrmQueryCache::DrmQueryCache(const std::string &filePath, const std::string &key) : filePath(filePath), key(key) {
+}
+
+DrmQueryCache::~DrmQueryCache() {
+    if (mappedData) {
+        unmapFile(mappedData, mappedSize);
+    }
+}
+
+bool DrmQueryCache::load() {
+    if (mappedData) {
+        return loaded;
+    }
+
+    size_t fileSize = 0;
+    auto fileData = mapFile(fileSize);
+    if (fileData == nullptr) {
+        dirty = true;
+        return false;
+    }
+
+    if (!parse(fileData, fileSize)) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "INFO: Device query cache %s is stale, it will be rewritten\n", filePath.c_str());
+        unmapFile(fileData, fileSize);
+        entries.clear();
+        dirty = true;
+        return false;
+    }
+
+    mappedData = fileData;
+    mappedSize = fileSize;
+    loaded = true;
+    return true;
+}
+
+bool DrmQueryCache::parse(const uint8_t *fileData, size_t fileSize) {
+    FileHeader header{};
+    if (fileSize < sizeof(FileHeader)) {
+        return false;
+    }
+    memcpy_s(&header, sizeof(header), fileData, sizeof(FileHeader));
+    if (header.magic != fileMagic || header.version != fileVersion || header.keySize != key.size() ||
+        fileSize - sizeof(FileHeader) < header.keySize) {
+        return false;
+    }
+
+    auto payload = fileData + sizeof(FileHeader);
+    const auto payloadSize = fileSize - sizeof(FileHeader);
+    if (memcmp(payload, key.data(), key.size()) != 0 ||
+        WideHash::hash(reinterpret_cast<const char *>(payload), payloadSize) != header.checksum) {
+        return false;
+    }
+
+    size_t offset = header.keySize;
+    for (uint32_t i = 0; i < header.entriesCount; i++) {
+        EntryHeader entryHeader{};
+        if (payloadSize - offset < sizeof(EntryHeader)) {
+            return false;
+        }
+        memcpy_s(&entryHeader, sizeof(entryHeader), payload + offset, sizeof(EntryHeader));
+        offset += sizeof(EntryHeader);
+        if (payloadSize - offset < entryHeader.dataSize) {
+            return false;
+        }
+        entries[{entryHeader.queryId, entryHeader.queryItemFlags}] = {payload + offset, static_cast<size_t>(entryHeader.dataSize)};
+        offset += static_cast<size_t>(entryHeader.dataSize);
+    }
+    return offset == payloadSize;
+}
+
+bool DrmQueryCache::find(uint32_t queryId, uint32_t queryItemFlags, const void *&data, size_t &dataSize) const {
+    auto it = entries.find({queryId, queryItemFlags});
+    if (it == entries.end()) {
+        return false;
+    }
+    data = it->second.data;
+    dataSize = it->second.dataSize;
+    return true;
+}
+
+void DrmQueryCache::store(uint32_t queryId, uint32_t queryItemFlags, const void *data, size_t dataSize) {
+    if (data == nullptr || dataSize == 0) {
+        return;
+    }
+    auto copy = std::make_unique<uint8_t[]>(dataSize);
+    memcpy_s(copy.get(), dataSize, data, dataSize);
+    entries[{queryId, queryItemFlags}] = {copy.get(), dataSize};
+    storedData.push_back(std::move(copy));
+    dirty = true;
+}
+
+bool DrmQueryCache::save() {
+    if (!dirty || entries.empty()) {
+        return true;
+    }
+
+    size_t fileSize = sizeof(FileHeader) + key.size();
+    for (const auto &entry : entries) {
+        fileSize += sizeof(EntryHeader) + entry.second.dataSize;
+    }
+
+    std::vector<uint8_t> fileData(fileSize);
+    auto dst = fileData.data() + sizeof(FileHeader);
+    memcpy_s(dst, key.size(), key.data(), key.size());
+    dst += key.size();
+    for (const auto &entry : entries) {
+        EntryHeader entryHeader{};
+        entryHeader.queryId = entry.first.first;
+        entryHeader.queryItemFlags = entry.first.second;
+        entryHeader.dataSize = entry.second.dataSize;
+        memcpy_s(dst, sizeof(EntryHeader), &entryHeader, sizeof(EntryHeader));
+        dst += sizeof(EntryHeader);
+        memcpy_s(dst, entry.second.dataSize, entry.second.data, entry.second.dataSize);
+        dst += entry.second.dataSize;
+    }
+
+    FileHeader header{};
+    header.keySize = static_cast<uint32_t>(key.size());
+    header.entriesCount = static_cast<uint32_t>(entries.size());
+    header.checksum = WideHash::hash(reinterpret_cast<const char *>(fileData.data() + sizeof(FileHeader)), fileSize - sizeof(FileHeader));
+    memcpy_s(fileData.data(), sizeof(FileHeader), &header, sizeof(FileHeader));
+
+    if (!writeFile(fileData)) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "WARNING: Writing device query cache %s failed\n", filePath.c_str());
+        return false;
+    }
+    dirty = false;
+    return true;
+}
+
+const uint8_t *DrmQueryCache::mapFile(size_t &fileSize) {
+    fileSize = 0;
+    auto fd = SysCalls::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat fileStat {};
+    void *fileData = MAP_FAILED;
+    if (SysCalls::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        fileData = SysCalls::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    SysCalls::close(fd);
+
+    if (fileData == MAP_FAILED) {
+        return nullptr;
+    }
+    fileSize = static_cast<size_t>(fileStat.st_size);
+    return reinterpret_cast<const uint8_t *>(fileData);
+}
+
+void DrmQueryCache::unmapFile(const uint8_t *fileData, size_t fileSize) {
+    SysCalls::munmap(const_cast<uint8_t *>(fileData), fileSize);
+}
+
+bool DrmQueryCache::writeFile(const std::vector<uint8_t> &fileData) {
+    // snapshot is replaced atomically, processes which mapped the previous one keep reading it
+    const auto tempFilePath = filePath + "." + std::to_string(SysCalls::getProcessId()) + ".tmp";
+    auto fd = SysCalls::openWithMode(tempFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        return false;
+    }
+
+    size_t written = 0;
+    while (written < fileData.size()) {
+        auto ret = SysCalls::write(fd, fileData.data() + written, fileData.size() - written);
+        if (ret <= 0) {
+            break;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    SysCalls::close(fd);
+
+    if (written != fileData.size() || SysCalls::rename(tempFilePath.c_str(), filePath.c_str()) != 0) {
+        SysCalls::unlink(tempFilePath);
+        return false;
+    }
+    return true;
+}
+
+} // namespace NEO
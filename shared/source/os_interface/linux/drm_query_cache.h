@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// On-disk snapshot of static DRM query results (hwconfig table, engines, memory regions, topology).
+// A snapshot is bound to a key describing the device, the KMD and the driver build.
+// Snapshot written for a different key or failing its checksum is ignored and rewritten.
+// Valid snapshot is mapped read-only, so repeated process launches skip the query ioctls.
+class DrmQueryCache {
+  public:
+    static constexpr uint32_t fileMagic = 0x514f454eu; // "NEOQ"
+    static constexpr uint32_t fileVersion = 2u;
+
+    struct FileHeader {
+        uint32_t magic = fileMagic;
+        uint32_t version = fileVersion;
+        uint32_t keySize = 0;
+        uint32_t entriesCount = 0;
+        uint64_t checksum = 0;
+    };
+    static_assert(sizeof(FileHeader) == 24);
+
+    struct EntryHeader {
+        uint32_t queryId = 0;
+        uint32_t queryItemFlags = 0;
+        uint64_t dataSize = 0;
+    };
+    static_assert(sizeof(EntryHeader) == 16);
+
+    static std::unique_ptr<DrmQueryCache> create(const std::string &pciPath, const std::string &key);
+
+    DrmQueryCache(const std::string &filePath, const std::string &key);
+    virtual ~DrmQueryCache();
+
+    bool load();
+    bool find(uint32_t queryId, uint32_t queryItemFlags, const void *&data, size_t &dataSize) const;
+    void store(uint32_t queryId, uint32_t queryItemFlags, const void *data, size_t dataSize);
+    bool save();
+
+    bool isLoaded() const { return loaded; }
+    size_t getEntriesCount() const { return entries.size(); }
+
+  protected:
+    using EntryKey = std::pair<uint32_t, uint32_t>;
+    struct Entry {
+        const uint8_t *data = nullptr;
+        size_t dataSize = 0;
+    };
+
+    bool parse(const uint8_t *fileData, size_t fileSize);
+
+    MOCKABLE_VIRTUAL const uint8_t *mapFile(size_t &fileSize);
+    MOCKABLE_VIRTUAL void unmapFile(const uint8_t *fileData, size_t fileSize);
+    MOCKABLE_VIRTUAL bool writeFile(const std::vector<uint8_t> &fileData);
+
+    std::string filePath;
+    std::string key;
+    std::map<EntryKey, Entry> entries;
+    std::vector<std::unique_ptr<uint8_t[]>> storedData;
+    const uint8_t *mappedData = nullptr;
+    size_t mappedSize = 0;
+    bool loaded = false;
+    bool dirty = false;
+};
+
+} // namespace NEO
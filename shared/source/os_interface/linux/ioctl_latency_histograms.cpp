@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/ioctl_latency_histograms.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <string>
+
+namespace NEO {
+
+namespace {
+std::string formatLatency(uint64_t timeNs) {
+    if (timeNs == IoctlLatencyHistograms::overflowLatency) {
+        return ">= 2^40";
+    }
+    return std::to_string(timeNs);
+}
+} // namespace
+
+IoctlLatencyHistograms::IoctlLatencyHistograms() : entries(std::make_unique<Entry[]>(requestsCount)) {
+}
+
+uint32_t IoctlLatencyHistograms::getBucketIndex(uint64_t timeNs) {
+    if (timeNs < subBucketsCount) {
+        return static_cast<uint32_t>(timeNs);
+    }
+    auto exponent = Math::log2(timeNs);
+    if (exponent >= maxExponent) {
+        return overflowBucketIndex;
+    }
+    auto subBucket = static_cast<uint32_t>(timeNs >> (exponent - subBucketBits)) & (subBucketsCount - 1);
+    return (exponent - subBucketBits + 1) * subBucketsCount + subBucket;
+}
+
+uint64_t IoctlLatencyHistograms::getBucketLowerBound(uint32_t bucketIndex) {
+    if (bucketIndex < subBucketsCount) {
+        return bucketIndex;
+    }
+    if (bucketIndex == overflowBucketIndex) {
+        return 1ull << maxExponent;
+    }
+    auto exponent = bucketIndex / subBucketsCount + subBucketBits - 1;
+    auto subBucket = bucketIndex % subBucketsCount;
+    return static_cast<uint64_t>(subBucketsCount + subBucket) << (exponent - subBucketBits);
+}
+
+uint64_t IoctlLatencyHistograms::getBucketUpperBound(uint32_t bucketIndex) {
+    if (bucketIndex < subBucketsCount) {
+        return bucketIndex + 1;
+    }
+    if (bucketIndex == overflowBucketIndex) {
+        return overflowLatency;
+    }
+    auto exponent = bucketIndex / subBucketsCount + subBucketBits - 1;
+    return getBucketLowerBound(bucketIndex) + (1ull << (exponent - subBucketBits));
+}
+
+void IoctlLatencyHistograms::record(DrmIoctl request, uint64_t timeNs, uint32_t retries, uint32_t interrupts, bool failed) {
+    auto &entry = entries[static_cast<size_t>(request)];
+    entry.count.fetch_add(1, std::memory_order_relaxed);
+    entry.totalTime.fetch_add(timeNs, std::memory_order_relaxed);
+    entry.buckets[getBucketIndex(timeNs)].fetch_add(1, std::memory_order_relaxed);
+    if (retries) {
+        entry.retries.fetch_add(retries, std::memory_order_relaxed);
+    }
+    if (interrupts) {
+        entry.interrupts.fetch_add(interrupts, std::memory_order_relaxed);
+    }
+    if (failed) {
+        entry.failures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t IoctlLatencyHistograms::getPercentile(DrmIoctl request, uint32_t percentile) const {
+    const auto &entry = getEntry(request);
+    uint64_t total = 0;
+    for (const auto &bucket : entry.buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    const auto rank = std::max<uint64_t>(1u, (total * percentile + 99) / 100);
+    uint64_t accumulated = 0;
+    for (uint32_t i = 0; i < bucketsCount; i++) {
+        accumulated += entry.buckets[i].load(std::memory_order_relaxed);
+        if (accumulated >= rank) {
+            return getBucketUpperBound(i);
+        }
+    }
+    return overflowLatency;
+}
+
+void IoctlLatencyHistograms::print(FILE *stream, IoctlHelper *ioctlHelper) const {
+    IoFunctions::fprintf(stream, "\n--- Ioctl latency histograms ---\n");
+    IoFunctions::fprintf(stream, "%41s %10s %15s %15s %15s %15s %15s %10s %10s %10s\n", "Request", "Count", "Avg(ns)", "p50(ns)", "p90(ns)", "p99(ns)", "p100(ns)", "Retries", "EINTR", "Failures");
+    for (size_t i = 0; i < requestsCount; i++) {
+        const auto request = static_cast<DrmIoctl>(i);
+        const auto &entry = entries[i];
+        const auto count = entry.count.load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        IoFunctions::fprintf(stream, "%41s %10" PRIu64 " %15" PRIu64 " %15s %15s %15s %15s %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n",
+                             getIoctlString(request, ioctlHelper).c_str(),
+                             count,
+                             entry.totalTime.load(std::memory_order_relaxed) / count,
+                             formatLatency(getPercentile(request, 50)).c_str(),
+                             formatLatency(getPercentile(request, 90)).c_str(),
+                             formatLatency(getPercentile(request, 99)).c_str(),
+                             formatLatency(getPercentile(request, 100)).c_str(),
+                             entry.retries.load(std::memory_order_relaxed),
+                             entry.interrupts.load(std::memory_order_relaxed),
+                             entry.failures.load(std::memory_order_relaxed));
+        for (uint32_t bucketIndex = 0; bucketIndex < bucketsCount; bucketIndex++) {
+            const auto bucketCount = entry.buckets[bucketIndex].load(std::memory_order_relaxed);
+            if (bucketCount == 0) {
+                continue;
+            }
+            if (bucketIndex == overflowBucketIndex) {
+                IoFunctions::fprintf(stream, "%41s >= 2^40 ns: %" PRIu64 "\n", "", bucketCount);
+            } else {
+                IoFunctions::fprintf(stream, "%41s [%" PRIu64 ", %" PRIu64 ") ns: %" PRIu64 "\n", "",
+                                     getBucketLowerBound(bucketIndex), getBucketUpperBound(bucketIndex), bucketCount);
+            }
+        }
+    }
+    IoFunctions::fprintf(stream, "\n");
+}
+
+} // namespace NEO
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/os_interface/linux/drm_wrappers.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+
+namespace NEO {
+
+class IoctlHelper;
+
+// Per request latency histograms of DRM ioctls, including retried calls.
+// Buckets are log-linear: every power of two range is split into subBucketsCount linear buckets,
+// which bounds the relative error of reported latencies to 1 / subBucketsCount.
+// Latencies of 2^maxExponent ns and more are counted in a separate overflow bucket without an upper bound.
+// Recording uses relaxed atomics only, so ioctls issued concurrently from many threads are never serialized.
+class IoctlLatencyHistograms {
+  public:
+    static constexpr uint32_t subBucketBits = 2u;
+    static constexpr uint32_t subBucketsCount = 1u << subBucketBits;
+    static constexpr uint32_t maxExponent = 40u;
+    static constexpr uint32_t overflowBucketIndex = (maxExponent - subBucketBits + 1) * subBucketsCount; // latencies >= 2^40 ns (~18 minutes)
+    static constexpr uint32_t bucketsCount = overflowBucketIndex + 1;
+    static constexpr uint64_t overflowLatency = std::numeric_limits<uint64_t>::max(); // percentile falling into the overflow bucket
+    static constexpr size_t requestsCount = static_cast<size_t>(DrmIoctl::perfDisable) + 1; // perfDisable is the last DrmIoctl
+
+    struct Entry {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> totalTime{0};
+        std::atomic<uint64_t> retries{0};
+        std::atomic<uint64_t> interrupts{0};
+        std::atomic<uint64_t> failures{0};
+        std::atomic<uint64_t> buckets[bucketsCount] = {};
+    };
+
+    IoctlLatencyHistograms();
+
+    void record(DrmIoctl request, uint64_t timeNs, uint32_t retries, uint32_t interrupts, bool failed);
+    const Entry &getEntry(DrmIoctl request) const { return entries[static_cast<size_t>(request)]; }
+    uint64_t getPercentile(DrmIoctl request, uint32_t percentile) const;
+    void print(FILE *stream, IoctlHelper *ioctlHelper) const;
+
+    static uint32_t getBucketIndex(uint64_t timeNs);
+    static uint64_t getBucketLowerBound(uint32_t bucketIndex);
+    static uint64_t getBucketUpperBound(uint32_t bucketIndex);
+
+  protected:
+    std::unique_ptr<Entry[]> entries;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,15 @@
 
 #include "shared/source/os_interface/debug_env_reader.h"
 
+#include <unistd.h>
+
 namespace NEO {
 
 SettingsReader *SettingsReader::createOsReader(bool userScope, const std::string &regKey) {
     return new EnvironmentVariableReader;
 }
+
+SettingsReader *SettingsReader::createOsSnapshotReader(const std::string &regKey) {
+    return new EnvironmentSnapshotReader(environ);
+}
 } // namespace NEO
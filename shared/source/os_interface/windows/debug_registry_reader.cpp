@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,10 @@ SettingsReader *SettingsReader::createOsReader(bool userScope, const std::string
     return new RegistryReader(userScope, regKey);
 }
 
+SettingsReader *SettingsReader::createOsSnapshotReader(const std::string &regKey) {
+    return createOsReader(false, regKey);
+}
+
 RegistryReader::RegistryReader(bool userScope, const std::string &regKey) : registryReadRootKey(regKey) {
     hkeyType = userScope ? HKEY_CURRENT_USER : HKEY_LOCAL_MACHINE;
     setUpProcessName();
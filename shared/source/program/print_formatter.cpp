@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,8 +20,6 @@ PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t print
       using32BitPointers(using32BitPointers),
       usesStringMap(stringLiteralMap != nullptr),
       stringLiteralMap(stringLiteralMap) {
-
-    output.reset(new char[maxSinglePrintStringLength]);
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
@@ -56,6 +54,9 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
 }
 
 void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
+    if (!output) {
+        output.reset(new char[maxSinglePrintStringLength]);
+    }
     size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
 
     size_t cursor = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@ class Device;
 struct ExternalFunctionInfo;
 struct LinkerInput;
 struct KernelInfo;
+class WorkerPool;
 
 struct ProgramInfo {
     ProgramInfo() = default;
@@ -48,6 +49,7 @@ struct ProgramInfo {
     uint32_t minScratchSpaceSize = 0U;
     uint32_t indirectDetectionVersion = 0U;
     size_t kernelMiscInfoPos = std::string::npos;
+    WorkerPool *workerPool = nullptr; // kernels are decoded in parallel on it, when enabled with ParallelKernelDecodeThreads
 };
 
 size_t getMaxInlineSlmNeeded(const ProgramInfo &programInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,14 +42,14 @@ int32_t SettingsFileReader::getSetting(const char *settingName, int32_t defaultV
 int64_t SettingsFileReader::getSetting(const char *settingName, int64_t defaultValue, DebugVarPrefix &type) {
     int64_t value = defaultValue;
 
-    auto prefixString = ApiSpecificConfig::getPrefixStrings();
-    auto prefixType = ApiSpecificConfig::getPrefixTypes();
+    const auto &prefixString = ApiSpecificConfig::getPrefixStrings();
+    const auto &prefixType = ApiSpecificConfig::getPrefixTypes();
 
     uint32_t i = 0;
     for (const auto &prefix : prefixString) {
         std::string neoKey = prefix;
         neoKey += settingName;
-        std::map<std::string, std::string>::iterator it = settingStringMap.find(neoKey);
+        auto it = settingStringMap.find(neoKey);
         if (it != settingStringMap.end()) {
             value = strtoll(it->second.c_str(), nullptr, 0);
             type = prefixType[i];
@@ -64,7 +64,7 @@ int64_t SettingsFileReader::getSetting(const char *settingName, int64_t defaultV
 int64_t SettingsFileReader::getSetting(const char *settingName, int64_t defaultValue) {
     int64_t value = defaultValue;
 
-    std::map<std::string, std::string>::iterator it = settingStringMap.find(std::string(settingName));
+    auto it = settingStringMap.find(std::string(settingName));
     if (it != settingStringMap.end()) {
         value = strtoll(it->second.c_str(), nullptr, 0);
     }
@@ -83,14 +83,14 @@ bool SettingsFileReader::getSetting(const char *settingName, bool defaultValue)
 std::string SettingsFileReader::getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) {
     std::string returnValue = value;
 
-    auto prefixString = ApiSpecificConfig::getPrefixStrings();
-    auto prefixType = ApiSpecificConfig::getPrefixTypes();
+    const auto &prefixString = ApiSpecificConfig::getPrefixStrings();
+    const auto &prefixType = ApiSpecificConfig::getPrefixTypes();
 
     uint32_t i = 0;
     for (const auto &prefix : prefixString) {
         std::string neoKey = prefix;
         neoKey += settingName;
-        std::map<std::string, std::string>::iterator it = settingStringMap.find(neoKey);
+        auto it = settingStringMap.find(neoKey);
         if (it != settingStringMap.end()) {
             returnValue = it->second;
             type = prefixType[i];
@@ -104,7 +104,7 @@ std::string SettingsFileReader::getSetting(const char *settingName, const std::s
 
 std::string SettingsFileReader::getSetting(const char *settingName, const std::string &value) {
     std::string returnValue = value;
-    std::map<std::string, std::string>::iterator it = settingStringMap.find(std::string(settingName));
+    auto it = settingStringMap.find(std::string(settingName));
     if (it != settingStringMap.end())
         returnValue = it->second;
 
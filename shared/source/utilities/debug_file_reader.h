@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,8 @@
 #include "shared/source/utilities/debug_settings_reader.h"
 
 #include <cstdint>
-#include <map>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 
@@ -33,6 +33,6 @@ class SettingsFileReader : public SettingsReader {
 
   protected:
     void parseStream(std::istream &inputStream);
-    std::map<std::string, std::string> settingStringMap;
+    std::unordered_map<std::string, std::string> settingStringMap;
 };
 }; // namespace NEO
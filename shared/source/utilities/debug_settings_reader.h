@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@ class SettingsReader {
         return createOsReader(false, regKey);
     }
     static SettingsReader *createOsReader(bool userScope, const std::string &regKey);
+    static SettingsReader *createOsSnapshotReader(const std::string &regKey);
     static SettingsReader *createFileReader();
     virtual int32_t getSetting(const char *settingName, int32_t defaultValue, DebugVarPrefix &type) = 0;
     virtual int32_t getSetting(const char *settingName, int32_t defaultValue) = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,10 @@
 
 namespace NEO {
 std::unique_ptr<SettingsReader> SettingsReaderCreator::create(const std::string &regKey) {
-    return std::unique_ptr<SettingsReader>(SettingsReader::create(regKey));
+    SettingsReader *readerImpl = SettingsReader::createFileReader();
+    if (readerImpl == nullptr) {
+        readerImpl = SettingsReader::createOsSnapshotReader(regKey);
+    }
+    return std::unique_ptr<SettingsReader>(readerImpl);
 }
 }; // namespace NEO
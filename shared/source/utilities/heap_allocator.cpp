@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,18 @@ double HeapAllocator::getUsage() const {
     return static_cast<double>(size - availableSize) / size;
 }
 
+uint64_t HeapAllocator::getLargestFreeChunkSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    uint64_t largestFreeChunkSize = pRightBound - pLeftBound;
+    for (const auto &freedChunk : freedChunksSmall) {
+        largestFreeChunkSize = std::max<uint64_t>(largestFreeChunkSize, freedChunk.size);
+    }
+    for (const auto &freedChunk : freedChunksBig) {
+        largestFreeChunkSize = std::max<uint64_t>(largestFreeChunkSize, freedChunk.size);
+    }
+    return largestFreeChunkSize;
+}
+
 uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
     size_t elements = freedChunks.size();
     size_t bestFitIndex = -1;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,7 @@ class HeapAllocator {
     }
 
     double getUsage() const;
+    uint64_t getLargestFreeChunkSize();
 
     uint64_t getBaseAddress() const {
         return this->baseAddress;
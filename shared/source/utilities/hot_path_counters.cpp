@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/hot_path_counters.h"
+
+#include "shared/source/utilities/io_functions.h"
+
+#include <cinttypes>
+#include <mutex>
+
+namespace NEO {
+
+thread_local HotPathCounters::Shard *HotPathCounters::threadShard = nullptr;
+
+namespace {
+struct ShardsState {
+    std::mutex mutex;
+    HotPathCounters::Shard *head = nullptr;
+    uint64_t retiredValues[HotPathCounters::Counter::count] = {};
+
+    // used by threads still counting while their thread locals are destroyed, updates may be lost on contention
+    HotPathCounters::Shard lateShard;
+};
+
+// leaked on purpose, thread locals of threads exiting after static destruction still retire their shards
+ShardsState &getShardsState() {
+    static auto *state = new ShardsState;
+    return *state;
+}
+
+// created during static initialization, so lazy creation never happens inside a caller's scope
+[[maybe_unused]] auto &shardsStateAtStartup = getShardsState();
+
+const char *counterNames[HotPathCounters::Counter::count] = {
+    "flushTask",
+    "flushImmediateTask",
+    "drmIoctl",
+    "blockingWait",
+    "commandBufferAllocation",
+    "residencyListRebuild",
+    "usmPoolHit",
+    "usmPoolMiss"};
+
+struct ShardOwner {
+    ShardOwner() {
+        auto &state = getShardsState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        shard.next = state.head;
+        if (state.head) {
+            state.head->prev = &shard;
+        }
+        state.head = &shard;
+    }
+
+    ~ShardOwner() {
+        auto &state = getShardsState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        for (uint32_t i = 0; i < HotPathCounters::Counter::count; i++) {
+            state.retiredValues[i] += shard.values[i].load(std::memory_order_relaxed);
+        }
+        if (shard.prev) {
+            shard.prev->next = shard.next;
+        } else {
+            state.head = shard.next;
+        }
+        if (shard.next) {
+            shard.next->prev = shard.prev;
+        }
+    }
+
+    HotPathCounters::Shard shard;
+};
+} // namespace
+
+HotPathCounters::Shard *HotPathCounters::registerThread() {
+    struct ThreadShardOwner : ShardOwner {
+        ~ThreadShardOwner() {
+            threadShard = &getShardsState().lateShard;
+        }
+    };
+    static thread_local ThreadShardOwner owner;
+    threadShard = &owner.shard;
+    return threadShard;
+}
+
+uint64_t HotPathCounters::get(Counter counter) {
+    auto &state = getShardsState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto value = state.retiredValues[counter] + state.lateShard.values[counter].load(std::memory_order_relaxed);
+    for (auto shard = state.head; shard != nullptr; shard = shard->next) {
+        value += shard->values[counter].load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+void HotPathCounters::getAll(uint64_t (&values)[Counter::count]) {
+    auto &state = getShardsState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (uint32_t i = 0; i < Counter::count; i++) {
+        values[i] = state.retiredValues[i] + state.lateShard.values[i].load(std::memory_order_relaxed);
+    }
+    for (auto shard = state.head; shard != nullptr; shard = shard->next) {
+        for (uint32_t i = 0; i < Counter::count; i++) {
+            values[i] += shard->values[i].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+const char *HotPathCounters::getName(Counter counter) {
+    return counter < Counter::count ? counterNames[counter] : "unknown";
+}
+
+void HotPathCounters::print(FILE *stream) {
+    uint64_t values[Counter::count];
+    getAll(values);
+    IoFunctions::fprintf(stream, "Hot path counters:\n");
+    for (uint32_t i = 0; i < Counter::count; i++) {
+        IoFunctions::fprintf(stream, "%s: %" PRIu64 "\n", counterNames[i], values[i]);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+namespace NEO {
+
+// Process wide event counters for driver hot paths.
+// Every thread increments its own cache line aligned shard with plain relaxed load/store (no locked RMW),
+// shards are summed only when counters are read. Values of exited threads are folded into retired totals.
+class HotPathCounters {
+  public:
+    enum Counter : uint32_t {
+        flushTask = 0,
+        flushImmediateTask,
+        drmIoctl,
+        blockingWait,
+        commandBufferAllocation,
+        residencyListRebuild,
+        usmPoolHit,
+        usmPoolMiss,
+        count
+    };
+
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> values[Counter::count] = {};
+        Shard *next = nullptr;
+        Shard *prev = nullptr;
+    };
+
+    static void increment(Counter counter) {
+        auto shard = threadShard;
+        if (shard == nullptr) {
+            shard = registerThread();
+        }
+        auto &value = shard->values[counter];
+        value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static uint64_t get(Counter counter);
+    static void getAll(uint64_t (&values)[Counter::count]);
+    static const char *getName(Counter counter);
+    static void print(FILE *stream);
+
+  protected:
+    static Shard *registerThread();
+
+    static thread_local Shard *threadShard;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,16 +7,23 @@
 
 #include "shared/source/utilities/isa_pool_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 
+#include <algorithm>
+
 namespace NEO {
 
 ISAPool::ISAPool(Device *device, bool isBuiltin, size_t storageSize)
-    : BaseType(device->getMemoryManager(), nullptr), device(device), isBuiltin(isBuiltin) {
-    this->chunkAllocator.reset(new NEO::HeapAllocator(startingOffset, storageSize, MemoryConstants::pageSize, 0u));
+    : ISAPool(device, isBuiltin, storageSize, MemoryConstants::pageSize) {
+}
+
+ISAPool::ISAPool(Device *device, bool isBuiltin, size_t storageSize, size_t allocationAlignment)
+    : BaseType(device->getMemoryManager(), nullptr), device(device), isBuiltin(isBuiltin), allocationAlignment(allocationAlignment) {
+    this->chunkAllocator.reset(new NEO::HeapAllocator(startingOffset, storageSize, allocationAlignment, 0u));
 
     auto allocationType = isBuiltin ? NEO::AllocationType::kernelIsaInternal : NEO::AllocationType::kernelIsa;
     auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(),
@@ -31,6 +38,7 @@ ISAPool::ISAPool(Device *device, bool isBuiltin, size_t storageSize)
 
 ISAPool::ISAPool(ISAPool &&pool) : BaseType(std::move(pool)) {
     this->isBuiltin = pool.isBuiltin;
+    this->allocationAlignment = pool.allocationAlignment;
     mtx.reset(pool.mtx.release());
     this->stackVec = std::move(pool.stackVec);
     this->device = pool.device;
@@ -54,6 +62,26 @@ const StackVec<NEO::GraphicsAllocation *, 1> &ISAPool::getAllocationsVector() {
     return stackVec;
 }
 
+size_t ISAPool::getStorageSize() const {
+    return static_cast<size_t>(this->chunkAllocator->getUsedSize() + this->chunkAllocator->getLeftSize());
+}
+
+size_t ISAPool::getUsedSize() const {
+    return static_cast<size_t>(this->chunkAllocator->getUsedSize());
+}
+
+size_t ISAPool::getPendingFreeSize() const {
+    size_t pendingFreeSize = 0u;
+    for (const auto &chunk : this->chunksToFree) {
+        pendingFreeSize += chunk.second;
+    }
+    return pendingFreeSize;
+}
+
+size_t ISAPool::getLargestFreeChunkSize() const {
+    return static_cast<size_t>(this->chunkAllocator->getLargestFreeChunkSize());
+}
+
 ISAPoolAllocator::ISAPoolAllocator(Device *device) : device(device) {
 }
 
@@ -61,8 +89,9 @@ ISAPoolAllocator::ISAPoolAllocator(Device *device) : device(device) {
  * @brief This method allocates SharedIsaAllocation object for a single user (module or program).
  * In first step, it checks if requested size for the ISA is higher than default pool size
  * and creates new ISA pool if it is.
+ * Requests smaller than a page are served from separate small ISA pools with finer chunk alignment.
  * Next, it tries to allocate using existing pools.
- * If failed, all existing pools are drained and performs allocation again.
+ * If failed, all existing pools are drained, empty pools are released and allocation is performed again.
  * If failed, creates another ISA pool and tries to allocate again.
  *
  * @param[in] isBuiltin flag specifying whether ISA will be used for builtin kernels
@@ -74,25 +103,31 @@ SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBu
     std::unique_lock lock(allocatorMtx);
 
     auto maxAllocationSize = getAllocationSize(isBuiltin);
+    auto smallIsa = isSmallIsa(size);
 
     if (size > maxAllocationSize) {
         addNewBufferPool(ISAPool(device, isBuiltin, size));
     }
 
-    auto sharedIsaAllocation = tryAllocateISA(isBuiltin, size);
+    auto sharedIsaAllocation = tryAllocateISA(isBuiltin, smallIsa, size);
     if (sharedIsaAllocation) {
         return sharedIsaAllocation;
     }
 
     drain();
 
-    sharedIsaAllocation = tryAllocateISA(isBuiltin, size);
+    sharedIsaAllocation = tryAllocateISA(isBuiltin, smallIsa, size);
+    releaseEmptyPools();
     if (sharedIsaAllocation) {
         return sharedIsaAllocation;
     }
 
-    addNewBufferPool(ISAPool(device, isBuiltin, getAllocationSize(isBuiltin)));
-    return tryAllocateISA(isBuiltin, size);
+    if (smallIsa) {
+        addNewBufferPool(ISAPool(device, isBuiltin, getSmallIsaAllocationSize(isBuiltin), smallIsaAllocationAlignment));
+    } else {
+        addNewBufferPool(ISAPool(device, isBuiltin, getAllocationSize(isBuiltin)));
+    }
+    return tryAllocateISA(isBuiltin, smallIsa, size);
 }
 
 /**
@@ -110,24 +145,81 @@ void ISAPoolAllocator::freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAll
 
 /**
  * @brief This method iterates over existing pools and tries to allocate shared isa allocation
- * on one of them. It will use only pools with correct isa type.
+ * on one of them. It will use only pools with correct isa type and size class.
+ * Most filled pools are tried first, so live ISA concentrates in fewer pools
+ * and the remaining ones can become empty and get released.
  *
  * @param[in] isBuiltin flag specifying whether ISA will be used for builtin kernels
+ * @param[in] smallIsa flag specifying whether small ISA pools should be used
  * @param[in] size size requested by the user.
  *
  * @return returns SharedIsaAllocation or nullptr if allocation didn't succeeded
  */
-SharedIsaAllocation *ISAPoolAllocator::tryAllocateISA(bool isBuiltin, size_t size) {
+SharedIsaAllocation *ISAPoolAllocator::tryAllocateISA(bool isBuiltin, bool smallIsa, size_t size) {
+    StackVec<ISAPool *, 8> candidatePools;
     for (auto &isaPoolParent : this->bufferPools) {
         auto &isaPool = static_cast<ISAPool &>(isaPoolParent);
-        if (isaPool.isBuiltinPool() == isBuiltin) {
-            auto sharedIsaAllocation = isaPool.allocateISA(size);
-            if (sharedIsaAllocation != nullptr) {
-                return sharedIsaAllocation;
-            }
+        if (isaPool.isBuiltinPool() == isBuiltin && isaPool.isSmallIsaPool() == smallIsa) {
+            candidatePools.push_back(&isaPool);
+        }
+    }
+    std::stable_sort(candidatePools.begin(), candidatePools.end(), [](const ISAPool *pool1, const ISAPool *pool2) {
+        return pool1->getUsedSize() > pool2->getUsedSize();
+    });
+
+    for (auto isaPool : candidatePools) {
+        auto sharedIsaAllocation = isaPool->allocateISA(size);
+        if (sharedIsaAllocation != nullptr) {
+            return sharedIsaAllocation;
         }
     }
     return nullptr;
 }
 
+/**
+ * @brief This method releases pools without any live or pending chunks.
+ * Pools are released only after drain, so their storage is no longer used by GPU.
+ */
+void ISAPoolAllocator::releaseEmptyPools() {
+    std::vector<ISAPool> keptPools;
+    keptPools.reserve(this->bufferPools.size());
+    for (auto &isaPool : this->bufferPools) {
+        if (isaPool.getUsedSize() == 0u && isaPool.chunksToFree.empty()) {
+            this->releasedPoolsCount++;
+            continue;
+        }
+        keptPools.push_back(std::move(isaPool));
+    }
+    this->bufferPools.swap(keptPools);
+}
+
+bool ISAPoolAllocator::isSmallIsa(size_t size) const {
+    if (debugManager.flags.EnableIsaPoolSizeClasses.get() == 0) {
+        return false;
+    }
+    return size < smallIsaSizeThreshold;
+}
+
+ISAPoolStatistics ISAPoolAllocator::getStatistics() {
+    std::unique_lock lock(allocatorMtx);
+    ISAPoolStatistics statistics{};
+    for (const auto &isaPool : this->bufferPools) {
+        statistics.poolsCount++;
+        statistics.smallIsaPoolsCount += isaPool.isSmallIsaPool() ? 1u : 0u;
+        statistics.totalSize += isaPool.getStorageSize();
+        statistics.usedSize += isaPool.getUsedSize();
+        statistics.pendingFreeSize += isaPool.getPendingFreeSize();
+        statistics.largestFreeChunksSize += isaPool.getLargestFreeChunkSize();
+    }
+    statistics.releasedPoolsCount = this->releasedPoolsCount;
+    return statistics;
+}
+
+void ISAPoolAllocator::printStatistics() {
+    auto statistics = getStatistics();
+    printf("ISA pools for root device %u: pools %zu, small ISA pools %zu, released pools %zu, size %zu, used %zu, pending free %zu, fill ratio %.2f, fragmentation %.2f\n",
+           device->getRootDeviceIndex(), statistics.poolsCount, statistics.smallIsaPoolsCount, statistics.releasedPoolsCount,
+           statistics.totalSize, statistics.usedSize, statistics.pendingFreeSize, statistics.getFillRatio(), statistics.getFragmentation());
+}
+
 } // namespace NEO
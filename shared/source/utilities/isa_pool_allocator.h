@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,35 +52,75 @@ class ISAPool : public AbstractBuffersPool<ISAPool, GraphicsAllocation> {
     ISAPool(ISAPool &&pool);
     ISAPool &operator=(ISAPool &&other) = delete;
     ISAPool(Device *device, bool isBuiltin, size_t storageSize);
+    ISAPool(Device *device, bool isBuiltin, size_t storageSize, size_t allocationAlignment);
     ~ISAPool() override;
 
     SharedIsaAllocation *allocateISA(size_t requestedSize) const;
     const StackVec<GraphicsAllocation *, 1> &getAllocationsVector();
     bool isBuiltinPool() const { return isBuiltin; }
+    bool isSmallIsaPool() const { return allocationAlignment < MemoryConstants::pageSize; }
+    size_t getStorageSize() const;
+    size_t getUsedSize() const;
+    size_t getPendingFreeSize() const;
+    size_t getLargestFreeChunkSize() const;
 
   private:
     Device *device;
     bool isBuiltin;
+    size_t allocationAlignment;
     StackVec<GraphicsAllocation *, 1> stackVec;
     std::unique_ptr<std::mutex> mtx;
 };
 
+struct ISAPoolStatistics {
+    size_t poolsCount = 0;
+    size_t smallIsaPoolsCount = 0;
+    size_t totalSize = 0;
+    size_t usedSize = 0;
+    size_t pendingFreeSize = 0;
+    size_t largestFreeChunksSize = 0;
+    size_t releasedPoolsCount = 0;
+
+    double getFillRatio() const {
+        return totalSize ? static_cast<double>(usedSize) / static_cast<double>(totalSize) : 0.0;
+    }
+
+    // Share of free pool memory which is not part of the largest free chunk of its pool
+    double getFragmentation() const {
+        auto freeSize = totalSize - usedSize;
+        return freeSize ? 1.0 - static_cast<double>(largestFreeChunksSize) / static_cast<double>(freeSize) : 0.0;
+    }
+};
+
 class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAllocation> {
   public:
+    static constexpr size_t smallIsaSizeThreshold = MemoryConstants::pageSize;
+    static constexpr size_t smallIsaAllocationAlignment = 256u;
+
     ISAPoolAllocator(Device *device);
     SharedIsaAllocation *requestGraphicsAllocationForIsa(bool isBuiltin, size_t size);
     void freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation);
+    ISAPoolStatistics getStatistics();
+    void printStatistics();
 
   private:
-    SharedIsaAllocation *tryAllocateISA(bool isBuiltin, size_t size);
+    SharedIsaAllocation *tryAllocateISA(bool isBuiltin, bool smallIsa, size_t size);
+    void releaseEmptyPools();
+    bool isSmallIsa(size_t size) const;
 
     size_t getAllocationSize(bool isBuiltin) const {
         return isBuiltin ? buitinAllocationSize : userAllocationSize;
     }
 
+    size_t getSmallIsaAllocationSize(bool isBuiltin) const {
+        return isBuiltin ? buitinAllocationSize : smallIsaAllocationSize;
+    }
+
     Device *device;
     size_t userAllocationSize = MemoryConstants::pageSize2M * 2;
     size_t buitinAllocationSize = MemoryConstants::pageSize64k;
+    size_t smallIsaAllocationSize = MemoryConstants::pageSize64k * 4;
+    size_t releasedPoolsCount = 0;
     std::mutex allocatorMtx;
 };
 
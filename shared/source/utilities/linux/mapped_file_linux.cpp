@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/utilities/mapped_file.h"
+
+#include <fcntl.h>
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::map(const std::string &fileName) {
+    auto fd = SysCalls::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+    struct stat fileStat = {};
+    if (0 == SysCalls::fstat(fd, &fileStat)) {
+        const auto fileSize = static_cast<size_t>(fileStat.st_size);
+        if (0U == fileSize) {
+            mappedFile.reset(new MappedFile);
+        } else {
+            auto mapping = SysCalls::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != mapping) {
+                mappedFile.reset(new MappedFile);
+                mappedFile->mapping = mapping;
+                mappedFile->data = static_cast<const uint8_t *>(mapping);
+                mappedFile->size = fileSize;
+            }
+        }
+    }
+
+    // mapping stays valid after the descriptor is closed
+    SysCalls::close(fd);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    if (nullptr != mapping) {
+        SysCalls::munmap(mapping, size);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/lz_compression.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace NEO {
+namespace LzCompression {
+
+namespace {
+constexpr size_t minMatch = 4u;
+constexpr size_t lastLiterals = 5u;
+constexpr size_t maxOffset = 0xffffu;
+constexpr uint8_t lengthMask = 0xfu;
+
+inline uint32_t read32(const uint8_t *ptr) {
+    uint32_t value;
+    memcpy_s(&value, sizeof(value), ptr, sizeof(value));
+    return value;
+}
+
+inline uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32u - hashLog);
+}
+
+inline bool writeLength(size_t length, uint8_t *dst, size_t dstCapacity, size_t &op) {
+    while (length >= 255u) {
+        if (op >= dstCapacity) {
+            return false;
+        }
+        dst[op++] = 255u;
+        length -= 255u;
+    }
+    if (op >= dstCapacity) {
+        return false;
+    }
+    dst[op++] = static_cast<uint8_t>(length);
+    return true;
+}
+
+inline bool readLength(const uint8_t *src, size_t srcSize, size_t &ip, size_t &length) {
+    uint8_t value = 255u;
+    while (value == 255u) {
+        if (ip >= srcSize) {
+            return false;
+        }
+        value = src[ip++];
+        length += value;
+    }
+    return true;
+}
+
+bool writeSequence(const uint8_t *literals, size_t literalsLength, size_t offset, size_t matchLength,
+                   uint8_t *dst, size_t dstCapacity, size_t &op) {
+    if (op >= dstCapacity) {
+        return false;
+    }
+    auto &token = dst[op++];
+    token = static_cast<uint8_t>(std::min<size_t>(literalsLength, lengthMask) << 4);
+    if (literalsLength >= lengthMask && !writeLength(literalsLength - lengthMask, dst, dstCapacity, op)) {
+        return false;
+    }
+    if (op + literalsLength > dstCapacity) {
+        return false;
+    }
+    memcpy_s(dst + op, dstCapacity - op, literals, literalsLength);
+    op += literalsLength;
+
+    if (matchLength == 0) {
+        return true;
+    }
+
+    if (op + 2 > dstCapacity) {
+        return false;
+    }
+    dst[op++] = static_cast<uint8_t>(offset & 0xffu);
+    dst[op++] = static_cast<uint8_t>(offset >> 8);
+
+    const auto matchCode = matchLength - minMatch;
+    token |= static_cast<uint8_t>(std::min<size_t>(matchCode, lengthMask));
+    if (matchCode >= lengthMask && !writeLength(matchCode - lengthMask, dst, dstCapacity, op)) {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+size_t compressBlock(const uint8_t *src, size_t srcSize, uint8_t *dst, size_t dstCapacity, MatchTable &hashTable) {
+    UNRECOVERABLE_IF(hashTable.size() != matchTableSize);
+    // positions are relative to the block, so entries left by the previous block are dropped
+    std::fill(hashTable.begin(), hashTable.end(), 0u);
+
+    size_t ip = 0;
+    size_t anchor = 0;
+    size_t op = 0;
+
+    if (srcSize > minMatch + lastLiterals) {
+        const size_t matchLimit = srcSize - lastLiterals;
+        while (ip + minMatch <= matchLimit) {
+            const auto sequence = read32(src + ip);
+            auto &hashEntry = hashTable[hashSequence(sequence)];
+            const size_t candidate = hashEntry;
+            hashEntry = static_cast<uint32_t>(ip + 1);
+
+            if (candidate == 0 || ip - (candidate - 1) > maxOffset || read32(src + candidate - 1) != sequence) {
+                ip++;
+                continue;
+            }
+
+            const size_t reference = candidate - 1;
+            size_t matchLength = minMatch;
+            while (ip + matchLength < matchLimit && src[reference + matchLength] == src[ip + matchLength]) {
+                matchLength++;
+            }
+
+            if (!writeSequence(src + anchor, ip - anchor, ip - reference, matchLength, dst, dstCapacity, op)) {
+                return 0;
+            }
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    if (!writeSequence(src + anchor, srcSize - anchor, 0, 0, dst, dstCapacity, op)) {
+        return 0;
+    }
+    return op;
+}
+
+bool decompressBlock(const uint8_t *src, size_t srcSize, uint8_t *dst, size_t dstSize) {
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (ip < srcSize) {
+        const auto token = src[ip++];
+
+        size_t literalsLength = token >> 4;
+        if (literalsLength == lengthMask && !readLength(src, srcSize, ip, literalsLength)) {
+            return false;
+        }
+        if (literalsLength > srcSize - ip || literalsLength > dstSize - op) {
+            return false;
+        }
+        memcpy_s(dst + op, dstSize - op, src + ip, literalsLength);
+        ip += literalsLength;
+        op += literalsLength;
+
+        if (ip == srcSize) {
+            return op == dstSize;
+        }
+
+        if (srcSize - ip < 2) {
+            return false;
+        }
+        const size_t offset = src[ip] | (static_cast<size_t>(src[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) {
+            return false;
+        }
+
+        size_t matchLength = token & lengthMask;
+        if (matchLength == lengthMask && !readLength(src, srcSize, ip, matchLength)) {
+            return false;
+        }
+        matchLength += minMatch;
+        if (matchLength > dstSize - op) {
+            return false;
+        }
+
+        const auto match = dst + op - offset;
+        if (offset >= matchLength) {
+            memcpy_s(dst + op, dstSize - op, match, matchLength);
+        } else {
+            // byte by byte copy, match overlaps its own output
+            for (size_t i = 0; i < matchLength; i++) {
+                dst[op + i] = match[i];
+            }
+        }
+        op += matchLength;
+    }
+    return false;
+}
+
+std::vector<char> compress(const char *src, size_t srcSize, uint32_t blockSize) {
+    blockSize = std::clamp(blockSize, 1u, maxBlockSize);
+
+    ContainerHeader header{};
+    header.blockSize = blockSize;
+    header.decompressedSize = srcSize;
+
+    std::vector<char> output(sizeof(ContainerHeader));
+    memcpy_s(output.data(), output.size(), &header, sizeof(header));
+
+    // blocks are compressed one by one on the calling thread, so they share the output buffer and the match table
+    std::vector<uint8_t> compressedBlock(blockSize);
+    MatchTable hashTable(matchTableSize);
+    for (size_t blockOffset = 0; blockOffset < srcSize; blockOffset += blockSize) {
+        const auto blockData = reinterpret_cast<const uint8_t *>(src) + blockOffset;
+        const auto currentBlockSize = std::min<size_t>(blockSize, srcSize - blockOffset);
+
+        auto compressedSize = compressBlock(blockData, currentBlockSize, compressedBlock.data(), currentBlockSize - 1, hashTable);
+        uint32_t blockDescriptor = static_cast<uint32_t>(compressedSize);
+        const uint8_t *blockPayload = compressedBlock.data();
+        if (compressedSize == 0) {
+            blockDescriptor = static_cast<uint32_t>(currentBlockSize) | storedBlockFlag;
+            compressedSize = currentBlockSize;
+            blockPayload = blockData;
+        }
+
+        const auto descriptorOffset = output.size();
+        output.resize(descriptorOffset + sizeof(blockDescriptor) + compressedSize);
+        memcpy_s(output.data() + descriptorOffset, sizeof(blockDescriptor), &blockDescriptor, sizeof(blockDescriptor));
+        memcpy_s(output.data() + descriptorOffset + sizeof(blockDescriptor), compressedSize, blockPayload, compressedSize);
+    }
+    return output;
+}
+
+bool isCompressed(const char *data, size_t size) {
+    if (data == nullptr || size < sizeof(ContainerHeader)) {
+        return false;
+    }
+    uint32_t magic = 0;
+    memcpy_s(&magic, sizeof(magic), data, sizeof(magic));
+    return magic == ContainerHeader::containerMagic;
+}
+
+std::unique_ptr<char[]> decompress(const char *src, size_t srcSize, size_t &decompressedSize, uint32_t maxThreads, WorkerPool *workerPool) {
+    decompressedSize = 0;
+    if (!isCompressed(src, srcSize)) {
+        return nullptr;
+    }
+
+    ContainerHeader header{};
+    memcpy_s(&header, sizeof(header), src, sizeof(header));
+    if (header.blockSize == 0 || header.blockSize > maxBlockSize ||
+        header.decompressedSize > maxDecompressedSize || header.decompressedSize > maxCompressionRatio * srcSize) {
+        return nullptr;
+    }
+
+    struct Block {
+        const uint8_t *src;
+        size_t srcSize;
+        size_t dstOffset;
+        size_t dstSize;
+        bool stored;
+    };
+    std::vector<Block> blocks;
+
+    size_t ip = sizeof(ContainerHeader);
+    uint64_t dstOffset = 0;
+    while (dstOffset < header.decompressedSize) {
+        uint32_t blockDescriptor = 0;
+        if (srcSize - ip < sizeof(blockDescriptor)) {
+            return nullptr;
+        }
+        memcpy_s(&blockDescriptor, sizeof(blockDescriptor), src + ip, sizeof(blockDescriptor));
+        ip += sizeof(blockDescriptor);
+
+        const size_t blockSrcSize = blockDescriptor & ~storedBlockFlag;
+        if (blockSrcSize == 0 || blockSrcSize > srcSize - ip) {
+            return nullptr;
+        }
+        const auto blockDstSize = static_cast<size_t>(std::min<uint64_t>(header.blockSize, header.decompressedSize - dstOffset));
+        blocks.push_back({reinterpret_cast<const uint8_t *>(src) + ip, blockSrcSize, static_cast<size_t>(dstOffset), blockDstSize, (blockDescriptor & storedBlockFlag) != 0});
+        ip += blockSrcSize;
+        dstOffset += blockDstSize;
+    }
+    if (ip != srcSize) {
+        return nullptr;
+    }
+
+    auto output = std::make_unique<char[]>(static_cast<size_t>(header.decompressedSize));
+    auto dst = reinterpret_cast<uint8_t *>(output.get());
+
+    std::atomic<size_t> nextBlock{0};
+    std::atomic<bool> success{true};
+    auto decompressBlocks = [&]() {
+        for (auto blockId = nextBlock++; blockId < blocks.size() && success; blockId = nextBlock++) {
+            const auto &block = blocks[blockId];
+            if (block.stored) {
+                if (block.srcSize != block.dstSize) {
+                    success = false;
+                    break;
+                }
+                memcpy_s(dst + block.dstOffset, block.dstSize, block.src, block.srcSize);
+            } else if (!decompressBlock(block.src, block.srcSize, dst + block.dstOffset, block.dstSize)) {
+                success = false;
+            }
+        }
+    };
+
+    uint32_t helpersCount = 0;
+    const auto threadsCount = std::min<size_t>(maxThreads, blocks.size());
+    if (workerPool != nullptr && header.decompressedSize >= minSizeForParallelDecompression && threadsCount > 1) {
+        helpersCount = static_cast<uint32_t>(threadsCount - 1);
+    }
+    if (helpersCount > 0) {
+        workerPool->runInParallel(helpersCount, decompressBlocks);
+    } else {
+        decompressBlocks();
+    }
+
+    if (!success) {
+        return nullptr;
+    }
+    decompressedSize = static_cast<size_t>(header.decompressedSize);
+    return output;
+}
+
+} // namespace LzCompression
+} // namespace NEO
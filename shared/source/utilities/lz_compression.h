@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+class WorkerPool;
+
+namespace LzCompression {
+
+// Byte oriented LZ77 codec used for compiler cache payloads.
+// Input is split into independent blocks, so blocks of large payloads can be decompressed in parallel.
+// Blocks which do not compress are stored as-is.
+struct ContainerHeader {
+    static constexpr uint32_t containerMagic = 0x5a4f454eu; // "NEOZ"
+
+    uint32_t magic = containerMagic;
+    uint32_t blockSize = 0;
+    uint64_t decompressedSize = 0;
+};
+static_assert(sizeof(ContainerHeader) == 16);
+
+constexpr uint32_t defaultBlockSize = 1u << 20;
+constexpr uint32_t maxBlockSize = 1u << 26;
+constexpr uint32_t storedBlockFlag = 1u << 31;
+constexpr size_t minSizeForParallelDecompression = 4 * defaultBlockSize;
+constexpr uint32_t maxDecompressionThreads = 8u;
+// a match costs at least one byte per 255 output bytes, so a valid container never expands more than that
+constexpr uint64_t maxCompressionRatio = 256u;
+constexpr uint64_t maxDecompressedSize = 1ull << 30;
+
+// last positions of hashed 4 byte sequences, 256 KB; reused by consecutive compressBlock calls
+constexpr uint32_t hashLog = 16u;
+constexpr size_t matchTableSize = 1u << hashLog;
+using MatchTable = std::vector<uint32_t>;
+
+size_t compressBlock(const uint8_t *src, size_t srcSize, uint8_t *dst, size_t dstCapacity, MatchTable &hashTable);
+bool decompressBlock(const uint8_t *src, size_t srcSize, uint8_t *dst, size_t dstSize);
+
+std::vector<char> compress(const char *src, size_t srcSize, uint32_t blockSize);
+bool isCompressed(const char *data, size_t size);
+std::unique_ptr<char[]> decompress(const char *src, size_t srcSize, size_t &decompressedSize, uint32_t maxThreads, WorkerPool *workerPool);
+
+} // namespace LzCompression
+} // namespace NEO
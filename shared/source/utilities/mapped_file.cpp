@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::createView(ArrayRef<const uint8_t> data) {
+    std::unique_ptr<MappedFile> view{new MappedFile};
+    view->data = data.begin();
+    view->size = data.size();
+    return view;
+}
+
+} // namespace NEO
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+// Read-only view of a whole input file.
+// Files are memory mapped, so big binaries (e.g. fatbinaries) are decoded in place
+// instead of being read into heap memory first. Pages are loaded only when accessed.
+class MappedFile : NonCopyableOrMovableClass {
+  public:
+    static std::unique_ptr<MappedFile> map(const std::string &fileName);
+    static std::unique_ptr<MappedFile> createView(ArrayRef<const uint8_t> data);
+    ~MappedFile();
+
+    ArrayRef<const uint8_t> getData() const {
+        return ArrayRef<const uint8_t>(data, size);
+    }
+
+    bool isMemoryMapped() const {
+        return nullptr != mapping;
+    }
+
+  protected:
+    MappedFile() = default;
+
+    const uint8_t *data = nullptr;
+    size_t size = 0U;
+    void *mapping = nullptr;
+};
+
+} // namespace NEO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+// Calls func(index) for every index in [0, count) using up to maxThreads threads, calling thread included.
+// Helper threads are taken from workerPool, so concurrent calls share its workers instead of creating threads;
+// without a pool all indices are processed on the calling thread.
+// Indices are handed out dynamically, so func must not depend on the order in which indices are processed.
+template <typename FuncT>
+void parallelFor(WorkerPool *workerPool, size_t count, uint32_t maxThreads, FuncT &&func) {
+    std::atomic<size_t> nextIndex{0};
+    auto processIndices = [&]() {
+        for (auto index = nextIndex++; index < count; index = nextIndex++) {
+            func(index);
+        }
+    };
+
+    const auto threadsCount = static_cast<uint32_t>(std::min<size_t>(maxThreads, count));
+    if (workerPool == nullptr || threadsCount <= 1) {
+        processIndices();
+        return;
+    }
+    workerPool->runInParallel(threadsCount - 1, processIndices);
+}
+
+} // namespace NEO
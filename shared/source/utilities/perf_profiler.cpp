@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,17 +7,21 @@
 
 #include "shared/source/utilities/perf_profiler.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include <atomic>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 #include <thread>
 
 namespace NEO {
 
 std::atomic<int> PerfProfiler::counter(0);
+std::unique_ptr<PerfTracer> PerfProfiler::tracer;
+std::mutex PerfProfiler::tracerMutex;
 
 thread_local PerfProfiler *gPerfProfiler = nullptr;
 
@@ -28,7 +32,17 @@ PerfProfiler *PerfProfiler::objects[PerfProfiler::objectsNumber] = {
 PerfProfiler *PerfProfiler::create(bool dumpToFile) {
     if (gPerfProfiler == nullptr) {
         int old = counter.fetch_add(1);
-        if (!dumpToFile) {
+        PerfTraceBuffer *traceBuffer = nullptr;
+        if (dumpToFile && debugManager.flags.PerfProfilerTraceFile.get() != "unk") {
+            std::lock_guard<std::mutex> lock(tracerMutex);
+            if (!tracer) {
+                tracer = PerfTracer::create(debugManager.flags.PerfProfilerTraceFile.get(), debugManager.flags.PerfProfilerTraceBufferSize.get());
+            }
+            traceBuffer = tracer ? tracer->createThreadBuffer() : nullptr;
+        }
+        if (traceBuffer) {
+            gPerfProfiler = new PerfProfiler(traceBuffer);
+        } else if (!dumpToFile) {
             std::unique_ptr<std::stringstream> logs = std::unique_ptr<std::stringstream>(new std::stringstream());
             std::unique_ptr<std::stringstream> sysLogs = std::unique_ptr<std::stringstream>(new std::stringstream());
             gPerfProfiler = new PerfProfiler(old, std::move(logs), std::move(sysLogs));
@@ -50,6 +64,9 @@ void PerfProfiler::destroyAll() {
     }
     counter = 0;
     gPerfProfiler = nullptr;
+
+    std::lock_guard<std::mutex> lock(tracerMutex);
+    tracer.reset();
 }
 
 PerfProfiler::PerfProfiler(int id, std::unique_ptr<std::ostream> &&logOut, std::unique_ptr<std::ostream> &&sysLogOut) {
@@ -86,11 +103,18 @@ PerfProfiler::PerfProfiler(int id, std::unique_ptr<std::ostream> &&logOut, std::
     *sysLogFile << "<report>" << std::endl;
 }
 
+PerfProfiler::PerfProfiler(PerfTraceBuffer *traceBuffer) : traceBuffer(traceBuffer) {
+}
+
 PerfProfiler::~PerfProfiler() {
-    *logFile << "</report>" << std::endl;
-    logFile->flush();
-    *sysLogFile << "</report>" << std::endl;
-    sysLogFile->flush();
+    if (logFile) {
+        *logFile << "</report>" << std::endl;
+        logFile->flush();
+    }
+    if (sysLogFile) {
+        *sysLogFile << "</report>" << std::endl;
+        sysLogFile->flush();
+    }
     gPerfProfiler = nullptr;
 }
 
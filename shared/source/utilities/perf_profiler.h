@@ -1,15 +1,18 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/perf_trace.h"
 #include "shared/source/utilities/timer_util.h"
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -37,16 +40,24 @@ class PerfProfiler {
 
     PerfProfiler(int id, std::unique_ptr<std::ostream> &&logOut = {nullptr},
                  std::unique_ptr<std::ostream> &&sysLogOut = {nullptr});
+    PerfProfiler(PerfTraceBuffer *traceBuffer);
     ~PerfProfiler();
 
     void apiEnter() {
+        if (traceBuffer) {
+            apiStartTick = CpuIntrinsics::rdtsc();
+            return;
+        }
         totalSystemTime = 0;
         systemLogs.clear();
-        systemLogs.reserve(20);
         apiTimer.start();
     }
 
     void apiLeave(const char *func) {
+        if (traceBuffer) {
+            traceBuffer->record(func, PerfTraceBuffer::EventType::api, 0u, apiStartTick, CpuIntrinsics::rdtsc());
+            return;
+        }
         apiTimer.end();
         logTimes(apiTimer.getStart(), apiTimer.getEnd(), apiTimer.get(), totalSystemTime, func);
     }
@@ -55,10 +66,18 @@ class PerfProfiler {
     void logSysTimes(long long start, unsigned long long time, unsigned int id);
 
     void systemEnter() {
+        if (traceBuffer) {
+            systemStartTick = CpuIntrinsics::rdtsc();
+            return;
+        }
         systemTimer.start();
     }
 
     void systemLeave(unsigned int id) {
+        if (traceBuffer) {
+            traceBuffer->record(nullptr, PerfTraceBuffer::EventType::system, id, systemStartTick, CpuIntrinsics::rdtsc());
+            return;
+        }
         systemTimer.end();
         logSysTimes(systemTimer.getStart(), systemTimer.get(), id);
         totalSystemTime += systemTimer.get();
@@ -83,16 +102,29 @@ class PerfProfiler {
         return objects[id];
     }
 
+    static PerfTracer *getTracer() {
+        return tracer.get();
+    }
+
+    PerfTraceBuffer *getTraceBuffer() {
+        return traceBuffer;
+    }
+
     static const unsigned int objectsNumber = 4096;
 
   protected:
     static std::atomic<int> counter;
     static PerfProfiler *objects[PerfProfiler::objectsNumber];
+    static std::unique_ptr<PerfTracer> tracer;
+    static std::mutex tracerMutex;
     Timer apiTimer;
     Timer systemTimer;
     unsigned long long totalSystemTime = 0;
     std::unique_ptr<std::ostream> logFile;
     std::unique_ptr<std::ostream> sysLogFile;
     std::vector<SystemLog> systemLogs;
+    PerfTraceBuffer *traceBuffer = nullptr;
+    uint64_t apiStartTick = 0;
+    uint64_t systemStartTick = 0;
 };
 }; // namespace NEO
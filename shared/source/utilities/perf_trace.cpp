@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/perf_trace.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+namespace NEO {
+
+PerfTraceBuffer::PerfTraceBuffer(uint32_t threadIndex, size_t requestedCapacity) : threadIndex(threadIndex) {
+    const auto capacity = Math::nextPowerOfTwo(static_cast<uint64_t>(std::max<size_t>(requestedCapacity, 2u)));
+    events = std::make_unique<PerfTraceEvent[]>(static_cast<size_t>(capacity));
+    mask = capacity - 1;
+}
+
+std::unique_ptr<PerfTracer> PerfTracer::create(const std::string &fileName, int32_t bufferCapacity) {
+    auto output = std::make_unique<std::ofstream>(fileName, std::ios::trunc);
+    if (!output->good()) {
+        return nullptr;
+    }
+    const auto capacity = bufferCapacity > 0 ? static_cast<size_t>(bufferCapacity) : defaultBufferCapacity;
+    return std::make_unique<PerfTracer>(std::move(output), capacity, defaultFlushPeriodMs, calibrateNsPerTick());
+}
+
+double PerfTracer::calibrateNsPerTick() {
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto startTick = CpuIntrinsics::rdtsc();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const auto endTick = CpuIntrinsics::rdtsc();
+    const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    if (endTick <= startTick) {
+        return 1.0;
+    }
+    return static_cast<double>(elapsedNs) / static_cast<double>(endTick - startTick);
+}
+
+PerfTracer::PerfTracer(std::unique_ptr<std::ostream> &&output, size_t bufferCapacity, uint32_t flushPeriodMs, double nsPerTick)
+    : output(std::move(output)), bufferCapacity(bufferCapacity), flushPeriodMs(flushPeriodMs), nsPerTick(nsPerTick) {
+    baseTick = CpuIntrinsics::rdtsc();
+    processId = SysCalls::getProcessId();
+
+    *this->output << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+    if (flushPeriodMs > 0) {
+        flusher = std::thread([this]() { this->flushLoop(); });
+    }
+}
+
+PerfTracer::~PerfTracer() {
+    if (flusher.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopFlusher = true;
+        }
+        flushCondition.notify_all();
+        flusher.join();
+    }
+
+    flush();
+    *output << "\n],\"otherData\":{\"droppedEvents\":\"" << getDroppedEventsCount() << "\"}}\n";
+    output->flush();
+}
+
+PerfTraceBuffer *PerfTracer::createThreadBuffer() {
+    std::lock_guard<std::mutex> lock(mtx);
+    buffers.push_back(std::make_unique<PerfTraceBuffer>(static_cast<uint32_t>(buffers.size()), bufferCapacity));
+    return buffers.back().get();
+}
+
+void PerfTracer::flushLoop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (!stopFlusher) {
+        flushCondition.wait_for(lock, std::chrono::milliseconds(flushPeriodMs));
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+size_t PerfTracer::flush() {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t flushedEvents = 0;
+    for (auto &buffer : buffers) {
+        const auto threadIndex = buffer->getThreadIndex();
+        flushedEvents += buffer->consume([&](const PerfTraceEvent &event) { this->writeEvent(event, threadIndex); });
+    }
+    output->flush();
+    return flushedEvents;
+}
+
+void PerfTracer::writeEvent(const PerfTraceEvent &event, uint32_t threadIndex) {
+    const auto start = event.start > baseTick ? event.start - baseTick : 0u;
+    const auto duration = event.end > event.start ? event.end - event.start : 0u;
+
+    *output << (writtenEvents == 0 ? "\n" : ",\n");
+    if (event.type == PerfTraceBuffer::EventType::system) {
+        *output << "{\"name\":\"system\",\"cat\":\"system\",\"args\":{\"id\":" << event.systemId << "}";
+    } else {
+        *output << "{\"name\":\"" << event.name << "\",\"cat\":\"api\"";
+    }
+    *output << ",\"ph\":\"X\",\"pid\":" << processId << ",\"tid\":" << threadIndex
+            << ",\"ts\":" << start * nsPerTick / 1000.0 << ",\"dur\":" << duration * nsPerTick / 1000.0 << "}";
+    writtenEvents++;
+}
+
+uint64_t PerfTracer::getDroppedEventsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    uint64_t droppedEvents = 0;
+    for (const auto &buffer : buffers) {
+        droppedEvents += buffer->getDroppedEventsCount();
+    }
+    return droppedEvents;
+}
+
+} // namespace NEO
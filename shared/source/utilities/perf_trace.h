@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+struct PerfTraceEvent {
+    const char *name = nullptr;
+    uint64_t start = 0;
+    uint64_t end = 0;
+    uint32_t systemId = 0;
+    uint32_t type = 0;
+};
+static_assert(sizeof(PerfTraceEvent) == 32);
+
+// Fixed size ring of trace events with a single producer thread and a single consumer (flusher).
+// Recording never blocks nor allocates, events recorded while the ring is full are dropped and counted.
+class PerfTraceBuffer {
+  public:
+    enum EventType : uint32_t {
+        api = 0,
+        system = 1
+    };
+
+    PerfTraceBuffer(uint32_t threadIndex, size_t requestedCapacity);
+
+    bool record(const char *name, uint32_t type, uint32_t systemId, uint64_t start, uint64_t end) {
+        const auto currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead - tail.load(std::memory_order_acquire) > mask) {
+            droppedEvents.store(droppedEvents.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        auto &event = events[currentHead & mask];
+        event.name = name;
+        event.start = start;
+        event.end = end;
+        event.systemId = systemId;
+        event.type = type;
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename ConsumerT>
+    size_t consume(ConsumerT &&consumer) {
+        const auto currentTail = tail.load(std::memory_order_relaxed);
+        const auto currentHead = head.load(std::memory_order_acquire);
+        for (auto position = currentTail; position != currentHead; position++) {
+            consumer(events[position & mask]);
+        }
+        tail.store(currentHead, std::memory_order_release);
+        return static_cast<size_t>(currentHead - currentTail);
+    }
+
+    uint32_t getThreadIndex() const { return threadIndex; }
+    size_t getCapacity() const { return static_cast<size_t>(mask + 1); }
+    uint64_t getDroppedEventsCount() const { return droppedEvents.load(std::memory_order_relaxed); }
+
+  protected:
+    std::unique_ptr<PerfTraceEvent[]> events;
+    uint64_t mask = 0;
+    uint32_t threadIndex = 0;
+    alignas(64) std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> droppedEvents{0};
+    alignas(64) std::atomic<uint64_t> tail{0};
+};
+
+// Owns per-thread trace buffers and drains them from a background thread into a Chrome trace (JSON) stream,
+// which can be opened in chrome://tracing or Perfetto UI. Timestamps are recorded as TSC ticks and converted
+// to microseconds only when flushing.
+class PerfTracer {
+  public:
+    static constexpr size_t defaultBufferCapacity = 65536u;
+    static constexpr uint32_t defaultFlushPeriodMs = 100u;
+
+    static std::unique_ptr<PerfTracer> create(const std::string &fileName, int32_t bufferCapacity);
+
+    PerfTracer(std::unique_ptr<std::ostream> &&output, size_t bufferCapacity, uint32_t flushPeriodMs, double nsPerTick);
+    virtual ~PerfTracer();
+
+    PerfTraceBuffer *createThreadBuffer();
+    size_t flush();
+
+    uint64_t getDroppedEventsCount();
+    uint64_t getWrittenEventsCount() const { return writtenEvents; }
+    double getNsPerTick() const { return nsPerTick; }
+
+    static double calibrateNsPerTick();
+
+  protected:
+    void flushLoop();
+    void writeEvent(const PerfTraceEvent &event, uint32_t threadIndex);
+
+    std::unique_ptr<std::ostream> output;
+    std::vector<std::unique_ptr<PerfTraceBuffer>> buffers;
+    std::mutex mtx;
+    std::condition_variable flushCondition;
+    std::thread flusher;
+    const size_t bufferCapacity;
+    const uint32_t flushPeriodMs;
+    const double nsPerTick;
+    uint64_t baseTick = 0;
+    uint64_t writtenEvents = 0;
+    uint32_t processId = 0;
+    bool stopFlusher = false;
+};
+
+} // namespace NEO
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/windows/sys_calls.h"
+#include "shared/source/utilities/mapped_file.h"
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::map(const std::string &fileName) {
+    auto file = SysCalls::createFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == file) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+    LARGE_INTEGER fileSize = {};
+    if (SysCalls::getFileSizeEx(file, &fileSize)) {
+        if (0 == fileSize.QuadPart) {
+            mappedFile.reset(new MappedFile);
+        } else {
+            auto fileMapping = SysCalls::createFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (nullptr != fileMapping) {
+                auto view = SysCalls::mapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+                if (nullptr != view) {
+                    mappedFile.reset(new MappedFile);
+                    mappedFile->mapping = view;
+                    mappedFile->data = static_cast<const uint8_t *>(view);
+                    mappedFile->size = static_cast<size_t>(fileSize.QuadPart);
+                }
+                // view keeps the mapping object alive
+                SysCalls::closeHandle(fileMapping);
+            }
+        }
+    }
+
+    SysCalls::closeHandle(file);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    if (nullptr != mapping) {
+        SysCalls::unmapViewOfFile(mapping);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+WorkerPool::WorkerPool(uint32_t workersCount) {
+    for (uint32_t i = 0; i < workersCount; i++) {
+        workers.emplace_back([this]() { this->run(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopRequested = true;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::enqueue(std::function<void()> &&task) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        tasks.push_back({std::move(task), nullptr});
+    }
+    condition.notify_one();
+}
+
+void WorkerPool::runInParallel(uint32_t helpersCount, const std::function<void()> &work) {
+    ParallelRun parallelRun;
+
+    helpersCount = std::min(helpersCount, getWorkersCount());
+    if (helpersCount > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            for (uint32_t i = 0; i < helpersCount; i++) {
+                tasks.push_back({[&parallelRun, &work]() {
+                                     work();
+                                     std::lock_guard<std::mutex> lock(parallelRun.mtx);
+                                     parallelRun.activeHelpers--;
+                                     parallelRun.condition.notify_one();
+                                 },
+                                 &parallelRun});
+            }
+        }
+        condition.notify_all();
+    }
+
+    work();
+
+    if (helpersCount > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            tasks.erase(std::remove_if(tasks.begin(), tasks.end(), [&parallelRun](const Task &task) { return task.parallelRun == &parallelRun; }), tasks.end());
+        }
+        // helpers increment activeHelpers while the pool lock is held, so all started helpers are counted here
+        std::unique_lock<std::mutex> lock(parallelRun.mtx);
+        parallelRun.condition.wait(lock, [&parallelRun]() { return parallelRun.activeHelpers == 0; });
+    }
+}
+
+void WorkerPool::run() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            condition.wait(lock, [this]() { return stopRequested || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            if (task.parallelRun != nullptr) {
+                std::lock_guard<std::mutex> parallelRunLock(task.parallelRun->mtx);
+                task.parallelRun->activeHelpers++;
+            }
+        }
+        task.function();
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Fixed set of driver owned worker threads executing queued tasks.
+// Pending tasks are drained before the pool is destroyed.
+class WorkerPool {
+  public:
+    WorkerPool(uint32_t workersCount);
+    virtual ~WorkerPool();
+
+    void enqueue(std::function<void()> &&task);
+    uint32_t getWorkersCount() const { return static_cast<uint32_t>(workers.size()); }
+
+    // Runs work on the calling thread and on up to helpersCount workers, returns when all started copies are done.
+    // Copies which did not start before the calling thread finished are dropped, so work must split itself dynamically
+    // and nested calls from worker threads cannot deadlock.
+    void runInParallel(uint32_t helpersCount, const std::function<void()> &work);
+
+  protected:
+    struct ParallelRun {
+        std::mutex mtx;
+        std::condition_variable condition;
+        uint32_t activeHelpers = 0;
+    };
+    struct Task {
+        std::function<void()> function;
+        ParallelRun *parallelRun = nullptr;
+    };
+
+    void run();
+
+    std::vector<std::thread> workers;
+    std::deque<Task> tasks;
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool stopRequested = false;
+};
+
+} // namespace NEO
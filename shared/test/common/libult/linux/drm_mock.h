@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,8 +47,10 @@ class DrmMock : public Drm {
     using Drm::pagingFence;
     using Drm::preemptionSupported;
     using Drm::query;
+    using Drm::queryCache;
     using Drm::queryAndSetVmBindPatIndexProgrammingSupport;
     using Drm::queryDeviceIdAndRevision;
+    using Drm::releaseQueryCache;
     using Drm::requirePerContextVM;
     using Drm::setPairAvailable;
     using Drm::setupIoctlHelper;
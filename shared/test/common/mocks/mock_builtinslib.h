@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,4 +15,5 @@ class MockBuiltinsLib : BuiltinsLib {
     using BuiltinsLib::allStorages;
     using BuiltinsLib::getBuiltinCode;
     using BuiltinsLib::getBuiltinResource;
+    using BuiltinsLib::registerCompiledBuiltin;
 };
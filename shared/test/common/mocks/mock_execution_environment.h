@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,7 @@ struct MockExecutionEnvironment : ExecutionEnvironment {
     using ExecutionEnvironment::adjustCcsCountImpl;
     using ExecutionEnvironment::directSubmissionController;
     using ExecutionEnvironment::rootDeviceEnvironments;
+    using ExecutionEnvironment::workerPool;
 
     ~MockExecutionEnvironment() override = default;
     MockExecutionEnvironment();
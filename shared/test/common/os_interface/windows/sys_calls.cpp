@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,9 @@ size_t closeHandleCalled = 0u;
 size_t getTempFileNameACalled = 0u;
 UINT getTempFileNameAResult = 0u;
 
+size_t moveFileExACalled = 0u;
+BOOL moveFileExAResult = TRUE;
+
 size_t lockFileExCalled = 0u;
 BOOL lockFileExResult = TRUE;
 
@@ -96,6 +99,18 @@ std::unordered_map<std::string, DWORD> pathAttributes;
 size_t setFilePointerCalled = 0u;
 DWORD setFilePointerResult = 0;
 
+size_t getFileSizeExCalled = 0u;
+BOOL getFileSizeExResult = TRUE;
+LONGLONG getFileSizeExFileSize = 0;
+
+size_t createFileMappingACalled = 0u;
+HANDLE createFileMappingAResult = nullptr;
+
+size_t mapViewOfFileCalled = 0u;
+LPVOID mapViewOfFileResult = nullptr;
+
+size_t unmapViewOfFileCalled = 0u;
+
 size_t setProcessPowerThrottlingStateCalled = 0u;
 ProcessPowerThrottlingState setProcessPowerThrottlingStateLastValue{};
 
@@ -167,7 +182,8 @@ UINT getTempFileNameA(LPCSTR lpPathName, LPCSTR lpPrefixString, UINT uUnique, LP
 }
 
 BOOL moveFileExA(LPCSTR lpExistingFileName, LPCSTR lpNewFileName, DWORD dwFlags) {
-    return TRUE;
+    moveFileExACalled++;
+    return moveFileExAResult;
 }
 
 BOOL lockFileEx(HANDLE hFile, DWORD dwFlags, DWORD dwReserved, DWORD nNumberOfBytesToLockLow, DWORD nNumberOfBytesToLockHigh, LPOVERLAPPED lpOverlapped) {
@@ -288,6 +304,27 @@ DWORD setFilePointer(HANDLE hFile, LONG lDistanceToMove, PLONG lpDistanceToMoveH
     return setFilePointerResult;
 }
 
+BOOL getFileSizeEx(HANDLE hFile, PLARGE_INTEGER lpFileSize) {
+    getFileSizeExCalled++;
+    lpFileSize->QuadPart = getFileSizeExFileSize;
+    return getFileSizeExResult;
+}
+
+HANDLE createFileMappingA(HANDLE hFile, LPSECURITY_ATTRIBUTES lpFileMappingAttributes, DWORD flProtect, DWORD dwMaximumSizeHigh, DWORD dwMaximumSizeLow, LPCSTR lpName) {
+    createFileMappingACalled++;
+    return createFileMappingAResult;
+}
+
+LPVOID mapViewOfFile(HANDLE hFileMappingObject, DWORD dwDesiredAccess, DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap) {
+    mapViewOfFileCalled++;
+    return mapViewOfFileResult;
+}
+
+BOOL unmapViewOfFile(LPCVOID lpBaseAddress) {
+    unmapViewOfFileCalled++;
+    return TRUE;
+}
+
 void coTaskMemFree(LPVOID pv) {
     return;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -206,3 +206,26 @@ HWTEST2_F(BuiltInSharedTest, GivenHeaplessModeEnabledWhenGetBuiltinResourceNames
         EXPECT_EQ(resourceNames[0], expectedResourceNameForRelease);
     }
 }
+
+HWTEST_F(BuiltInSharedTest, givenCompiledBuiltinRegisteredWhenGettingBinaryResourceForUnregisteredPlatformThenCompiledBinaryIsReturnedOnlyForIdenticalHardwareInfo) {
+    auto builtinsLib = std::make_unique<MockBuiltinsLib>();
+    auto &hwInfo = *pDevice->getRootDeviceEnvironment().getMutableHardwareInfo();
+    hwInfo.ipVersion.value += 0xdead;
+
+    EXPECT_EQ(0U, builtinsLib->getBuiltinResource(EBuiltInOps::copyBufferToBuffer, BuiltinCode::ECodeType::binary, *pDevice).size());
+
+    const char compiledBinary[] = "compiled copy_buffer_to_buffer";
+    builtinsLib->registerCompiledBuiltin(EBuiltInOps::copyBufferToBuffer, *pDevice, compiledBinary, sizeof(compiledBinary));
+    EXPECT_EQ(1u, pDevice->getExecutionEnvironment()->compiledBuiltinsCache->getEntriesCount());
+
+    auto otherBuiltinsLib = std::make_unique<MockBuiltinsLib>();
+    auto builtinCode = otherBuiltinsLib->getBuiltinCode(EBuiltInOps::copyBufferToBuffer, BuiltinCode::ECodeType::any, *pDevice);
+    EXPECT_EQ(BuiltinCode::ECodeType::binary, builtinCode.type);
+    ASSERT_EQ(sizeof(compiledBinary), builtinCode.resource.size());
+    EXPECT_EQ(0, memcmp(compiledBinary, builtinCode.resource.data(), sizeof(compiledBinary)));
+
+    EXPECT_EQ(0U, builtinsLib->getBuiltinResource(EBuiltInOps::fillBuffer, BuiltinCode::ECodeType::binary, *pDevice).size());
+
+    hwInfo.platform.usRevId += 1;
+    EXPECT_EQ(0U, builtinsLib->getBuiltinResource(EBuiltInOps::copyBufferToBuffer, BuiltinCode::ECodeType::binary, *pDevice).size());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -3773,6 +3773,29 @@ HWTEST2_F(CommandStreamReceiverHwTest,
     EXPECT_EQ(nullptr, frontEndCmd);
 }
 
+HWTEST2_F(CommandStreamReceiverHwTest,
+          givenImmediateFlushTaskWhenStateIsNotChangedBetweenSubmissionsThenStateCommandsAreCountedAsElided,
+          IsAtLeastXeHpCore) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto &statistics = commandStreamReceiver.getStateCommandStatistics();
+    statistics.reset();
+
+    commandStreamReceiver.flushImmediateTask(commandStream, commandStream.getUsed(), immediateFlushTaskFlags, *pDevice);
+
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::frontEnd).emitted);
+    EXPECT_EQ(0u, statistics.getCounters(StateCommandType::frontEnd).elided);
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::stateComputeMode).emitted);
+    EXPECT_EQ(0u, statistics.getCounters(StateCommandType::stateComputeMode).elided);
+
+    commandStreamReceiver.flushImmediateTask(commandStream, commandStream.getUsed(), immediateFlushTaskFlags, *pDevice);
+
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::frontEnd).emitted);
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::frontEnd).elided);
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::stateComputeMode).emitted);
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::stateComputeMode).elided);
+    EXPECT_EQ(1u, statistics.getCounters(StateCommandType::stateBaseAddress).elided);
+}
+
 HWTEST2_F(CommandStreamReceiverHwTest,
           givenImmediateFlushTaskOnChangingFrontEndPropertiesPlatformWhenFrontEndAlreadyInitializedAndFrontEndPropertyChangeRequiredThenDispatchFrontEndCommand,
           IsWithinXeGfxFamily) {
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
@@ -16,6 +17,9 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/lz_compression.h"
+#include "shared/source/utilities/mapped_file.h"
+#include "shared/source/utilities/worker_pool.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
@@ -23,6 +27,7 @@
 #include "shared/test/common/mocks/mock_compiler_cache.h"
 #include "shared/test/common/mocks/mock_compiler_interface.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_io_functions.h"
 #include "shared/test/common/test_macros/test.h"
 
@@ -106,6 +111,41 @@ TEST(HashGeneration, givenMisalignedBufferWithSizeOneWhenPassedToUpdateFunctionT
     alignedFree(originalPtr);
 }
 
+TEST(HashGeneration, givenKnownInputsWhenWideHashIsCalculatedThenReferenceValuesAreReturned) {
+    EXPECT_EQ(0xef46db3751d8e999u, WideHash::hash("", 0));
+    EXPECT_EQ(0x44bc2cf5ad770999u, WideHash::hash("abc", 3));
+    EXPECT_EQ(WideHash::hash("", 0), WideHash::hash(nullptr, 0));
+
+    const char nobodyInspects[] = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(0xfbcea83c8a378bf1u, WideHash::hash(nobodyInspects, sizeof(nobodyInspects) - 1));
+
+    const char oneStripe[] = "abcdefghijklmnopqrstuvwxyz0123456";
+    EXPECT_EQ(0xbf2cd639b4143b80u, WideHash::hash(oneStripe, 32));
+    EXPECT_EQ(0x4f89e4082bcbf673u, WideHash::hash(oneStripe, 33));
+
+    std::vector<char> longInput(1029);
+    for (size_t i = 0; i < longInput.size(); i++) {
+        longInput[i] = static_cast<char>(i * 7 + 3);
+    }
+    EXPECT_EQ(0x33612d614025420du, WideHash::hash(longInput.data(), longInput.size()));
+}
+
+TEST(HashGeneration, givenDataSplitIntoChunksWhenWideHashIsUpdatedThenResultIsSameAsForSingleUpdate) {
+    std::vector<char> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 31);
+    }
+    const auto expectedHash = WideHash::hash(data.data(), data.size());
+
+    for (size_t chunkSize : {1u, 7u, 31u, 32u, 33u, 100u}) {
+        WideHash hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min<size_t>(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expectedHash, hash.finish()) << "chunk size " << chunkSize;
+    }
+}
+
 TEST(CompilerCacheHashTests, WhenHashingThenResultIsDeterministic) {
     Hash hash;
 
@@ -379,6 +419,471 @@ TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsRet
     EXPECT_EQ(0U, size);
 }
 
+TEST(CompilerCacheTests, GivenMemoryCacheEnabledWhenBinaryIsCachedThenItIsLoadedFromMemoryAndStatisticsAreUpdated) {
+    CompilerCacheConfig config{};
+    config.memoryCacheSize = MemoryConstants::kiloByte;
+    CompilerCacheMemoryTier memoryTier(config.memoryCacheSize);
+    CompilerCache cache(config);
+    cache.setMemoryTier(&memoryTier);
+
+    const char binary[] = "12345678";
+    cache.cacheBinary("some_hash", binary, sizeof(binary));
+
+    size_t size = 0;
+    auto ret = cache.loadCachedBinary("some_hash", size);
+    ASSERT_NE(nullptr, ret);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, ret.get(), size));
+
+    ret = cache.loadCachedBinary("----do-not-exists----", size);
+    EXPECT_EQ(nullptr, ret);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.memoryHits);
+    EXPECT_EQ(1u, statistics.memoryMisses);
+    EXPECT_EQ(sizeof(binary), statistics.memoryBytesLoaded);
+    EXPECT_EQ(0u, statistics.diskHits);
+    EXPECT_EQ(1u, statistics.diskMisses);
+}
+
+TEST(CompilerCacheTests, GivenExecutionEnvironmentWhenGettingCompilerCacheMemoryTierTwiceThenSingleSharedTierIsReturned) {
+    MockExecutionEnvironment executionEnvironment;
+    auto memoryTier = executionEnvironment.getCompilerCacheMemoryTier(MemoryConstants::kiloByte);
+    ASSERT_NE(nullptr, memoryTier);
+    EXPECT_EQ(MemoryConstants::kiloByte, memoryTier->getMaxSize());
+    EXPECT_EQ(memoryTier, executionEnvironment.getCompilerCacheMemoryTier(MemoryConstants::megaByte));
+}
+
+TEST(CompilerCacheTests, GivenExecutionEnvironmentWhenGettingWorkerPoolTwiceThenSinglePoolLeavingOneHardwareThreadForCallerIsReturned) {
+    MockExecutionEnvironment executionEnvironment;
+    auto workerPool = executionEnvironment.getWorkerPool();
+    ASSERT_NE(nullptr, workerPool);
+    EXPECT_EQ(std::max(std::thread::hardware_concurrency(), 1u) - 1, workerPool->getWorkersCount());
+    EXPECT_EQ(workerPool, executionEnvironment.getWorkerPool());
+}
+
+TEST(CompilerCacheTests, GivenParallelKernelDecodeThreadsWhenGettingKernelDecodeWorkerPoolThenSharedWorkerPoolIsReturnedOnlyWhenParallelDecodingIsEnabled) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+    for (auto parallelDecodeThreads : {-1, 0, 1}) {
+        debugManager.flags.ParallelKernelDecodeThreads.set(parallelDecodeThreads);
+        EXPECT_EQ(nullptr, executionEnvironment.getKernelDecodeWorkerPool());
+    }
+    EXPECT_EQ(nullptr, executionEnvironment.workerPool.get());
+
+    debugManager.flags.ParallelKernelDecodeThreads.set(4);
+    EXPECT_EQ(executionEnvironment.getWorkerPool(), executionEnvironment.getKernelDecodeWorkerPool());
+}
+
+TEST(CompilerCacheTests, GivenPrintCompilerCacheStatisticsWhenCacheIsDestroyedThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintCompilerCacheStatistics.set(true);
+    auto cache = std::make_unique<CompilerCache>(CompilerCacheConfig{});
+    size_t size = 0;
+    cache->loadCachedBinary("----do-not-exists----", size);
+
+    testing::internal::CaptureStdout();
+    cache.reset();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Compiler cache statistics: memory hits 0, memory misses 0, memory bytes loaded 0, memory tier used 0 of 0 bytes, disk hits 0, disk misses 1"));
+}
+
+TEST(CompilerCacheTests, GivenMemoryCacheIsFullWhenNewBinaryIsInsertedThenLeastRecentlyUsedBinaryIsEvicted) {
+    CompilerCacheMemoryTier memoryTier(16u);
+    const char binary[8] = {};
+
+    memoryTier.insert("hash0", binary, sizeof(binary));
+    memoryTier.insert("hash1", binary, sizeof(binary));
+    EXPECT_EQ(16u, memoryTier.getUsedSize());
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, memoryTier.find("hash0", size));
+
+    memoryTier.insert("hash2", binary, sizeof(binary));
+    EXPECT_EQ(16u, memoryTier.getUsedSize());
+    EXPECT_NE(nullptr, memoryTier.find("hash0", size));
+    EXPECT_EQ(nullptr, memoryTier.find("hash1", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_NE(nullptr, memoryTier.find("hash2", size));
+
+    const char tooBigBinary[32] = {};
+    memoryTier.insert("hash3", tooBigBinary, sizeof(tooBigBinary));
+    EXPECT_EQ(nullptr, memoryTier.find("hash3", size));
+    EXPECT_EQ(16u, memoryTier.getUsedSize());
+}
+
+class CompilerCacheWithInMemoryDisk : public CompilerCache {
+  public:
+    CompilerCacheWithInMemoryDisk(const CompilerCacheConfig &config) : CompilerCache(config) {}
+
+    bool cacheBinaryOnDisk(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) override {
+        storedBinaries[kernelFileHash] = std::string(pBinary, binarySize);
+        return true;
+    }
+    std::unique_ptr<char[]> loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize) override {
+        cachedBinarySize = 0;
+        auto it = storedBinaries.find(kernelFileHash);
+        if (it == storedBinaries.end()) {
+            return nullptr;
+        }
+        cachedBinarySize = it->second.size();
+        auto binary = std::make_unique<char[]>(cachedBinarySize);
+        memcpy_s(binary.get(), cachedBinarySize, it->second.data(), cachedBinarySize);
+        return binary;
+    }
+
+    std::unordered_map<std::string, std::string> storedBinaries;
+};
+
+TEST(CompilerCacheTests, GivenCompressionEnabledWhenBinaryIsCachedThenCompressedBinaryIsStoredAndDecompressedOnLoad) {
+    CompilerCacheConfig config{};
+    config.compressionEnabled = true;
+    CompilerCacheWithInMemoryDisk cache(config);
+
+    std::string binary;
+    for (int i = 0; i < 1000; i++) {
+        binary += "zebin_section_" + std::to_string(i % 10);
+    }
+    EXPECT_TRUE(cache.cacheBinary("some_hash", binary.data(), binary.size()));
+
+    const auto &storedBinary = cache.storedBinaries["some_hash"];
+    EXPECT_TRUE(LzCompression::isCompressed(storedBinary.data(), storedBinary.size()));
+    EXPECT_LT(storedBinary.size(), binary.size());
+
+    size_t size = 0;
+    auto loaded = cache.loadCachedBinary("some_hash", size);
+    ASSERT_NE(nullptr, loaded);
+    ASSERT_EQ(binary.size(), size);
+    EXPECT_EQ(0, memcmp(binary.data(), loaded.get(), size));
+}
+
+class MockCompilerCachePack : public CompilerCachePack {
+  public:
+    using CompilerCachePack::index;
+    using CompilerCachePack::rewriteRequired;
+
+    MockCompilerCachePack(std::vector<char> &packData, size_t maxSize) : CompilerCachePack("cl_cache.pack", maxSize), packData(packData) {
+        // views point to the pack data, so it must not be reallocated
+        packData.reserve(MemoryConstants::pageSize);
+    }
+
+    uint64_t getFileSize() override {
+        return packData.size();
+    }
+    std::shared_ptr<MappedFile> mapPackFile() override {
+        mapPackFileCalled++;
+        return MappedFile::createView(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(packData.data()), packData.size()));
+    }
+    bool appendToFile(const void *src, size_t size, uint64_t &offset) override {
+        offset = packData.size();
+        packData.insert(packData.end(), static_cast<const char *>(src), static_cast<const char *>(src) + size);
+        return true;
+    }
+    bool createTempFile() override {
+        tempData.clear();
+        return true;
+    }
+    bool appendToTempFile(const void *src, size_t size) override {
+        tempData.insert(tempData.end(), static_cast<const char *>(src), static_cast<const char *>(src) + size);
+        return true;
+    }
+    bool closeTempFile(bool replacePackFile) override {
+        if (replacePackFile && failReplacingPackFile) {
+            return false;
+        }
+        if (replacePackFile) {
+            packData = tempData;
+        }
+        return true;
+    }
+    bool lockPackFile(UnifiedHandle &lockHandle) override {
+        lockPackFileCalled++;
+        return lockPackFileResult;
+    }
+    void unlockPackFile(UnifiedHandle &lockHandle) override {
+        unlockPackFileCalled++;
+    }
+
+    std::vector<char> &packData;
+    std::vector<char> tempData;
+    bool failReplacingPackFile = false;
+    bool lockPackFileResult = true;
+    uint32_t lockPackFileCalled = 0u;
+    uint32_t unlockPackFileCalled = 0u;
+    uint32_t mapPackFileCalled = 0u;
+};
+
+TEST(CompilerCachePackTests, GivenStoredBinariesWhenPackIsReopenedThenBinariesAreLoaded) {
+    std::vector<char> packData;
+    const char binary0[] = "binary0";
+    const char binary1[] = "binary_1";
+    {
+        MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+        EXPECT_TRUE(pack.open());
+        EXPECT_TRUE(pack.store("hash0", binary0, sizeof(binary0)));
+        EXPECT_TRUE(pack.store("hash1", binary1, sizeof(binary1)));
+        EXPECT_TRUE(pack.store("hash1", binary1, sizeof(binary1)));
+        EXPECT_EQ(2u, pack.getEntriesCount());
+        EXPECT_EQ(packData.size(), pack.getPackSize());
+    }
+
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    EXPECT_TRUE(pack.open());
+    EXPECT_FALSE(pack.rewriteRequired);
+    EXPECT_EQ(2u, pack.getEntriesCount());
+
+    size_t size = 0;
+    auto loaded = pack.load("hash1", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary1), size);
+    EXPECT_EQ(0, memcmp(binary1, loaded.get(), size));
+
+    EXPECT_EQ(nullptr, pack.load("hash2", size));
+    EXPECT_EQ(0u, size);
+}
+
+TEST(CompilerCachePackTests, GivenTornLastRecordWhenPackIsOpenedThenRecordIsSkippedAndPackIsRewrittenOnNextStore) {
+    std::vector<char> packData;
+    const char binary[] = "binary";
+    {
+        MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+        pack.open();
+        pack.store("hash0", binary, sizeof(binary));
+        pack.store("hash1", binary, sizeof(binary));
+    }
+    packData.resize(packData.size() - 2);
+
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    pack.open();
+    EXPECT_TRUE(pack.rewriteRequired);
+    EXPECT_EQ(1u, pack.getEntriesCount());
+
+    EXPECT_TRUE(pack.store("hash2", binary, sizeof(binary)));
+    EXPECT_FALSE(pack.rewriteRequired);
+    EXPECT_EQ(2u, pack.getEntriesCount());
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, pack.load("hash0", size));
+    EXPECT_NE(nullptr, pack.load("hash2", size));
+    EXPECT_EQ(nullptr, pack.load("hash1", size));
+}
+
+TEST(CompilerCachePackTests, GivenCorruptedBinaryWhenLoadingThenNullIsReturnedAndEntryIsRemoved) {
+    std::vector<char> packData;
+    const char binary[] = "binary";
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    pack.open();
+    pack.store("hash0", binary, sizeof(binary));
+    packData[packData.size() - 2] = 'X';
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, pack.load("hash0", size));
+    EXPECT_EQ(0u, pack.getEntriesCount());
+}
+
+TEST(CompilerCachePackTests, GivenFullPackWhenStoringBinaryThenLeastRecentlyUsedBinariesAreEvicted) {
+    std::vector<char> packData;
+    char binary[64] = {};
+    const auto recordSize = sizeof(CompilerCachePack::RecordHeader) + strlen("hash0") + sizeof(binary);
+    MockCompilerCachePack pack(packData, sizeof(CompilerCachePack::FileHeader) + 3 * recordSize);
+    pack.open();
+
+    EXPECT_TRUE(pack.store("hash0", binary, sizeof(binary)));
+    EXPECT_TRUE(pack.store("hash1", binary, sizeof(binary)));
+    EXPECT_TRUE(pack.store("hash2", binary, sizeof(binary)));
+    EXPECT_EQ(3u, pack.getEntriesCount());
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, pack.load("hash0", size));
+
+    EXPECT_TRUE(pack.store("hash3", binary, sizeof(binary)));
+    EXPECT_LE(pack.getPackSize(), sizeof(CompilerCachePack::FileHeader) + 3 * recordSize);
+    EXPECT_EQ(packData.size(), pack.getPackSize());
+    EXPECT_NE(nullptr, pack.load("hash0", size));
+    EXPECT_NE(nullptr, pack.load("hash3", size));
+    EXPECT_EQ(nullptr, pack.load("hash1", size));
+}
+
+TEST(CompilerCachePackTests, GivenFailingPackRewriteWhenStoringBinaryThenFalseIsReturnedAndOldPackIsKept) {
+    std::vector<char> packData;
+    char binary[64] = {};
+    const auto recordSize = sizeof(CompilerCachePack::RecordHeader) + strlen("hash0") + sizeof(binary);
+    MockCompilerCachePack pack(packData, sizeof(CompilerCachePack::FileHeader) + 2 * recordSize);
+    pack.open();
+    EXPECT_TRUE(pack.store("hash0", binary, sizeof(binary)));
+    EXPECT_TRUE(pack.store("hash1", binary, sizeof(binary)));
+    const auto oldPackData = packData;
+
+    pack.failReplacingPackFile = true;
+    EXPECT_FALSE(pack.store("hash2", binary, sizeof(binary)));
+    EXPECT_EQ(oldPackData, packData);
+    EXPECT_EQ(2u, pack.getEntriesCount());
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, pack.load("hash0", size));
+    EXPECT_NE(nullptr, pack.load("hash1", size));
+}
+
+TEST(CompilerCachePackTests, GivenPackWhenStoringBinaryThenPackFileIsLockedAndUnlocked) {
+    std::vector<char> packData;
+    const char binary[] = "binary";
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    pack.open();
+    EXPECT_EQ(1u, pack.lockPackFileCalled);
+    EXPECT_EQ(1u, pack.unlockPackFileCalled);
+
+    EXPECT_TRUE(pack.store("hash0", binary, sizeof(binary)));
+    EXPECT_EQ(2u, pack.lockPackFileCalled);
+    EXPECT_EQ(2u, pack.unlockPackFileCalled);
+
+    pack.lockPackFileResult = false;
+    const auto packSize = packData.size();
+    EXPECT_FALSE(pack.store("hash1", binary, sizeof(binary)));
+    EXPECT_EQ(3u, pack.lockPackFileCalled);
+    EXPECT_EQ(2u, pack.unlockPackFileCalled);
+    EXPECT_EQ(packSize, packData.size());
+    EXPECT_EQ(1u, pack.getEntriesCount());
+}
+
+TEST(CompilerCachePackTests, GivenRecordAppendedByAnotherWriterWhenStoringBinaryThenOffsetIsTakenFromPackFile) {
+    std::vector<char> packData;
+    const char binary0[] = "binary0";
+    const char binary1[] = "binary_1";
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    MockCompilerCachePack otherWriter(packData, MemoryConstants::kiloByte);
+    pack.open();
+    otherWriter.open();
+
+    EXPECT_TRUE(otherWriter.store("hash0", binary0, sizeof(binary0)));
+    EXPECT_TRUE(pack.store("hash1", binary1, sizeof(binary1)));
+    EXPECT_EQ(packData.size(), pack.getPackSize());
+
+    EXPECT_EQ(2u, pack.getEntriesCount());
+
+    size_t size = 0;
+    auto loaded = pack.load("hash1", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(0, memcmp(binary1, loaded.get(), size));
+    EXPECT_NE(nullptr, pack.load("hash0", size));
+}
+
+TEST(CompilerCachePackTests, GivenBinaryStoredByAnotherWriterWhenStoringSameBinaryThenItIsNotAppendedAgain) {
+    std::vector<char> packData;
+    const char binary[] = "binary";
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    MockCompilerCachePack otherWriter(packData, MemoryConstants::kiloByte);
+    pack.open();
+    otherWriter.open();
+
+    EXPECT_TRUE(otherWriter.store("hash0", binary, sizeof(binary)));
+    const auto packSize = packData.size();
+    EXPECT_TRUE(pack.store("hash0", binary, sizeof(binary)));
+    EXPECT_EQ(packSize, packData.size());
+    EXPECT_EQ(1u, pack.getEntriesCount());
+}
+
+TEST(CompilerCachePackTests, GivenRecordAppendedByAnotherWriterWhenRewritingPackThenRecordIsKept) {
+    std::vector<char> packData;
+    char binary[64] = {};
+    const auto recordSize = sizeof(CompilerCachePack::RecordHeader) + strlen("hash0") + sizeof(binary);
+    MockCompilerCachePack pack(packData, sizeof(CompilerCachePack::FileHeader) + 3 * recordSize);
+    MockCompilerCachePack otherWriter(packData, sizeof(CompilerCachePack::FileHeader) + 3 * recordSize);
+    pack.open();
+    otherWriter.open();
+
+    EXPECT_TRUE(pack.store("hash0", binary, sizeof(binary)));
+    EXPECT_TRUE(pack.store("hash1", binary, sizeof(binary)));
+    EXPECT_TRUE(otherWriter.store("hash2", binary, sizeof(binary)));
+
+    EXPECT_TRUE(pack.store("hash3", binary, sizeof(binary)));
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, pack.load("hash2", size));
+    EXPECT_NE(nullptr, pack.load("hash3", size));
+    EXPECT_EQ(nullptr, pack.load("hash0", size));
+}
+
+TEST(CompilerCachePackTests, GivenUsedBinariesWhenUsageIsFlushedAndPackIsReopenedThenLeastRecentlyUsedOrderIsRestored) {
+    std::vector<char> packData;
+    const char binary[] = "binary";
+    {
+        MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+        pack.open();
+        pack.store("hash0", binary, sizeof(binary));
+        pack.store("hash1", binary, sizeof(binary));
+
+        EXPECT_TRUE(pack.flushUsage());
+        const auto packSize = packData.size();
+
+        size_t size = 0;
+        EXPECT_NE(nullptr, pack.load("hash0", size));
+        EXPECT_TRUE(pack.flushUsage());
+        EXPECT_EQ(packSize + sizeof(CompilerCachePack::RecordHeader) + strlen("hash0"), packData.size());
+    }
+
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    pack.open();
+    EXPECT_FALSE(pack.rewriteRequired);
+    EXPECT_EQ(2u, pack.getEntriesCount());
+    EXPECT_GT(pack.index["hash0"].lruStamp, pack.index["hash1"].lruStamp);
+}
+
+TEST(CompilerCachePackTests, GivenRewrittenPackWhenPackIsReopenedThenIndexAndLruStampsAreReadFromIndexRecord) {
+    std::vector<char> packData;
+    char binary[64] = {};
+    const auto recordSize = sizeof(CompilerCachePack::RecordHeader) + strlen("hash0") + sizeof(binary);
+    const auto maxSize = sizeof(CompilerCachePack::FileHeader) + 5 * recordSize + recordSize / 4;
+    std::unordered_map<std::string, uint64_t> lruStamps;
+    {
+        MockCompilerCachePack pack(packData, maxSize);
+        pack.open();
+        for (int i = 0; i < 5; i++) {
+            EXPECT_TRUE(pack.store("hash" + std::to_string(i), binary, sizeof(binary)));
+        }
+        size_t size = 0;
+        EXPECT_NE(nullptr, pack.load("hash0", size));
+        EXPECT_TRUE(pack.store("hash5", binary, sizeof(binary)));
+        EXPECT_EQ(3u, pack.getEntriesCount());
+        for (const auto &indexEntry : pack.index) {
+            lruStamps[indexEntry.first] = indexEntry.second.lruStamp;
+        }
+    }
+
+    CompilerCachePack::RecordHeader indexRecordHeader{};
+    memcpy_s(&indexRecordHeader, sizeof(indexRecordHeader), packData.data() + sizeof(CompilerCachePack::FileHeader), sizeof(indexRecordHeader));
+    EXPECT_EQ(CompilerCachePack::RecordHeader::indexRecordMagic, indexRecordHeader.magic);
+
+    MockCompilerCachePack pack(packData, maxSize);
+    pack.open();
+    EXPECT_FALSE(pack.rewriteRequired);
+    ASSERT_EQ(3u, pack.getEntriesCount());
+    EXPECT_EQ(lruStamps["hash0"], pack.index["hash0"].lruStamp);
+    EXPECT_EQ(lruStamps["hash4"], pack.index["hash4"].lruStamp);
+    EXPECT_GT(pack.index["hash5"].lruStamp, pack.index["hash0"].lruStamp);
+    EXPECT_GT(pack.index["hash0"].lruStamp, pack.index["hash4"].lruStamp);
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, pack.load("hash0", size));
+    EXPECT_NE(nullptr, pack.load("hash4", size));
+    EXPECT_NE(nullptr, pack.load("hash5", size));
+    EXPECT_EQ(nullptr, pack.load("hash1", size));
+}
+
+TEST(CompilerCachePackTests, GivenOpenedPackWhenLoadingBinariesThenPackIsNotMappedAgain) {
+    std::vector<char> packData;
+    const char binary[] = "binary";
+    MockCompilerCachePack pack(packData, MemoryConstants::kiloByte);
+    pack.open();
+    pack.store("hash0", binary, sizeof(binary));
+    const auto mapPackFileCalled = pack.mapPackFileCalled;
+
+    size_t size = 0;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NE(nullptr, pack.load("hash0", size));
+    }
+    EXPECT_EQ(mapPackFileCalled, pack.mapPackFileCalled);
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -713,7 +713,7 @@ TEST_F(LinkerTests, GivenRelocationToInstructionSegmentWithLocalUndefinedSymbolW
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
 
-    linker.patchInstructionsSegments({instructionSegmentToPatch}, unresolvedExternals, kernelDescriptors);
+    linker.patchInstructionsSegments({instructionSegmentToPatch}, unresolvedExternals, kernelDescriptors, nullptr);
     auto instructionSegmentPatchedData = reinterpret_cast<uint64_t *>(ptrOffset(instructionSegmentToPatch.hostPointer, static_cast<size_t>(rela.offset)));
     EXPECT_EQ(0u, static_cast<uint64_t>(*instructionSegmentPatchedData));
     EXPECT_EQ(0u, unresolvedExternals.size());
@@ -999,6 +999,48 @@ HWTEST_F(LinkerTests, givenUnresolvedExternalWhenPatchingInstructionsThenLinkPar
     EXPECT_EQ(std::string(entry.r_symbol), std::string(unresolvedExternals[0].unresolvedRelocation.symbolName));
 }
 
+HWTEST_F(LinkerTests, givenParallelKernelDecodeThreadsWhenPatchingMultipleInstructionSegmentsThenUnresolvedExternalsAreReportedInOrderOfSegments) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ParallelKernelDecodeThreads.set(4);
+
+    constexpr uint32_t numSegments = 16U;
+    NEO::LinkerInput linkerInput;
+    for (uint32_t segId = 0U; segId < numSegments; segId++) {
+        vISA::GenRelocEntry entry = {};
+        entry.r_symbol[0] = 'A';
+        entry.r_offset = 8 + segId * 8;
+        entry.r_type = vISA::GenRelocType::R_SYM_ADDR;
+        EXPECT_TRUE(linkerInput.decodeRelocationTable(&entry, 1, segId));
+    }
+
+    NEO::Linker linker(linkerInput);
+    NEO::Linker::SegmentInfo globalVar, globalConst, exportedFunc;
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    NEO::Linker::ExternalFunctionsT externalFunctions;
+
+    std::vector<std::vector<char>> instructionSegments(numSegments, std::vector<char>(256));
+    NEO::Linker::PatchableSegments patchableInstructionSegments(numSegments);
+    for (uint32_t segId = 0U; segId < numSegments; segId++) {
+        patchableInstructionSegments[segId].hostPointer = instructionSegments[segId].data();
+        patchableInstructionSegments[segId].segmentSize = instructionSegments[segId].size();
+    }
+    NEO::GraphicsAllocation *patchableGlobalVarSeg = nullptr;
+    NEO::GraphicsAllocation *patchableConstVarSeg = nullptr;
+
+    auto linkResult = linker.link(
+        globalVar, globalConst, exportedFunc, {},
+        patchableGlobalVarSeg, patchableConstVarSeg, patchableInstructionSegments,
+        unresolvedExternals, pDevice, nullptr, 0, nullptr, 0, kernelDescriptors, externalFunctions);
+    EXPECT_EQ(NEO::LinkingStatus::linkedPartially, linkResult);
+    ASSERT_EQ(numSegments, unresolvedExternals.size());
+    for (uint32_t segId = 0U; segId < numSegments; segId++) {
+        EXPECT_EQ(segId, unresolvedExternals[segId].instructionsSegmentId);
+        EXPECT_EQ(8U + segId * 8U, unresolvedExternals[segId].unresolvedRelocation.offset);
+        EXPECT_FALSE(unresolvedExternals[segId].internalError);
+    }
+}
+
 HWTEST_F(LinkerTests, givenValidSymbolsAndRelocationsThenInstructionSegmentsAreProperlyPatched) {
     NEO::LinkerInput linkerInput;
 
@@ -2412,7 +2454,7 @@ TEST_F(LinkerTests, givenRelaWhenPatchingInstructionsSegmentThenAddendIsAdded) {
 
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
-    linker.patchInstructionsSegments({segmentToPatch}, unresolvedExternals, kernelDescriptors);
+    linker.patchInstructionsSegments({segmentToPatch}, unresolvedExternals, kernelDescriptors, nullptr);
     EXPECT_EQ(static_cast<uint64_t>(rela.addend + symValue), segmentData);
 }
 
@@ -2493,7 +2535,7 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstruction
     segmentToPatch.segmentSize = sizeof(segmentData);
 
     NEO::Linker::UnresolvedExternals unresolvedExternals;
-    linker.patchInstructionsSegments({segmentToPatch}, unresolvedExternals, kernelDescriptors);
+    linker.patchInstructionsSegments({segmentToPatch}, unresolvedExternals, kernelDescriptors, nullptr);
     auto perThreadPayloadOffsetPatchedValue = reinterpret_cast<uint32_t *>(ptrOffset(segmentToPatch.hostPointer, static_cast<size_t>(rel.offset)));
     uint32_t expectedPatchedValue = kd.kernelAttributes.crossThreadDataSize - kd.kernelAttributes.inlineDataPayloadSize;
     EXPECT_EQ(expectedPatchedValue, static_cast<uint32_t>(*perThreadPayloadOffsetPatchedValue));
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
@@ -1086,3 +1087,107 @@ TEST(CompilerCacheHelper, GivenNotExistingPathWhenGettingFileSizeThenZeroIsRetur
 
     EXPECT_EQ(getFileSize("/tmp/file1"), 0u);
 }
+
+class CompilerCachePackMockLinux : public CompilerCachePack {
+  public:
+    using CompilerCachePack::CompilerCachePack;
+    using CompilerCachePack::closeTempFile;
+    using CompilerCachePack::createTempFile;
+    using CompilerCachePack::lockPackFile;
+    using CompilerCachePack::tempFilePath;
+    using CompilerCachePack::unlockPackFile;
+};
+
+namespace CompilerCachePackLinux {
+std::vector<std::string> *unlinkFiles;
+
+decltype(NEO::SysCalls::sysCallsUnlink) mockUnlink = [](const std::string &pathname) -> int {
+    unlinkFiles->push_back(pathname);
+    return 0;
+};
+} // namespace CompilerCachePackLinux
+
+TEST(CompilerCachePackLinuxTests, GivenRenameFailureWhenClosingTempFileThenOnlyTempFileIsUnlinkedAndFalseIsReturned) {
+    std::vector<std::string> unlinkFiles;
+    VariableBackup<std::vector<std::string> *> unlinkFilesBackup(&CompilerCachePackLinux::unlinkFiles, &unlinkFiles);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsUnlink)> unlinkBackup(&NEO::SysCalls::sysCallsUnlink, CompilerCachePackLinux::mockUnlink);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsRename)> renameBackup(&NEO::SysCalls::sysCallsRename, [](const char *currName, const char *dstName) -> int { return -1; });
+
+    CompilerCachePackMockLinux pack("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    ASSERT_TRUE(pack.createTempFile());
+    EXPECT_FALSE(pack.closeTempFile(true));
+
+    ASSERT_EQ(1u, unlinkFiles.size());
+    EXPECT_EQ(pack.tempFilePath, unlinkFiles[0]);
+}
+
+TEST(CompilerCachePackLinuxTests, GivenSuccessfulRenameWhenClosingTempFileThenNothingIsUnlinkedAndTrueIsReturned) {
+    std::vector<std::string> unlinkFiles;
+    VariableBackup<std::vector<std::string> *> unlinkFilesBackup(&CompilerCachePackLinux::unlinkFiles, &unlinkFiles);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsUnlink)> unlinkBackup(&NEO::SysCalls::sysCallsUnlink, CompilerCachePackLinux::mockUnlink);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsRename)> renameBackup(&NEO::SysCalls::sysCallsRename, [](const char *currName, const char *dstName) -> int { return 0; });
+
+    CompilerCachePackMockLinux pack("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    ASSERT_TRUE(pack.createTempFile());
+    EXPECT_TRUE(pack.closeTempFile(true));
+    EXPECT_TRUE(unlinkFiles.empty());
+}
+
+TEST(CompilerCachePackLinuxTests, GivenTwoRewritesWhenCreatingTempFilesThenNamesAreUniqueAndContainProcessId) {
+    CompilerCachePackMockLinux pack("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    ASSERT_TRUE(pack.createTempFile());
+    const auto firstTempFilePath = pack.tempFilePath;
+    pack.closeTempFile(false);
+
+    ASSERT_TRUE(pack.createTempFile());
+    pack.closeTempFile(false);
+
+    EXPECT_NE(firstTempFilePath, pack.tempFilePath);
+    EXPECT_NE(std::string::npos, firstTempFilePath.find("cl_cache.pack." + std::to_string(NEO::SysCalls::getProcessId()) + "."));
+}
+
+TEST(CompilerCachePackLinuxTests, GivenPackWhenLockingPackFileThenLockFileIsOpenedAndLockedExclusively) {
+    VariableBackup<decltype(NEO::SysCalls::flockCalled)> flockBackup(&NEO::SysCalls::flockCalled, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        std::string_view path = pathname;
+        EXPECT_EQ(path, "/home/cl_cache/cl_cache.pack.lock");
+        EXPECT_NE(0, flags & O_CREAT);
+        return NEO::SysCalls::fakeFileDescriptor;
+    });
+
+    CompilerCachePackMockLinux pack("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    UnifiedHandle lockHandle{-1};
+    EXPECT_TRUE(pack.lockPackFile(lockHandle));
+    EXPECT_EQ(NEO::SysCalls::fakeFileDescriptor, std::get<int>(lockHandle));
+    EXPECT_EQ(1, NEO::SysCalls::flockCalled);
+
+    pack.unlockPackFile(lockHandle);
+    EXPECT_EQ(-1, std::get<int>(lockHandle));
+    EXPECT_EQ(2, NEO::SysCalls::flockCalled);
+}
+
+TEST(CompilerCachePackLinuxTests, GivenLockFailureWhenLockingPackFileThenFalseIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::flockRetVal)> flockBackup(&NEO::SysCalls::flockRetVal, -1);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        return NEO::SysCalls::fakeFileDescriptor;
+    });
+
+    CompilerCachePackMockLinux pack("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    UnifiedHandle lockHandle{-1};
+    EXPECT_FALSE(pack.lockPackFile(lockHandle));
+    EXPECT_EQ(-1, std::get<int>(lockHandle));
+}
+
+TEST(CompilerCachePackLinuxTests, GivenSamePackPathWhenGettingPackThenSinglePackObjectIsSharedWithinProcess) {
+    VariableBackup<FILE *> fopenBackup(&NEO::IoFunctions::mockFopenReturned, nullptr);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        return NEO::SysCalls::fakeFileDescriptor;
+    });
+
+    auto pack0 = CompilerCachePack::getOrCreate("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    auto pack1 = CompilerCachePack::getOrCreate("/home/cl_cache/cl_cache.pack", MemoryConstants::megaByte);
+    auto otherPack = CompilerCachePack::getOrCreate("/home/cl_cache/l0_cache.pack", MemoryConstants::megaByte);
+
+    EXPECT_EQ(pack0.get(), pack1.get());
+    EXPECT_NE(pack0.get(), otherPack.get());
+}
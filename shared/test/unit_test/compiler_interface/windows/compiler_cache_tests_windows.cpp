@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/string.h"
@@ -101,6 +102,9 @@ extern size_t closeHandleCalled;
 extern size_t getTempFileNameACalled;
 extern UINT getTempFileNameAResult;
 
+extern size_t moveFileExACalled;
+extern BOOL moveFileExAResult;
+
 extern size_t lockFileExCalled;
 extern BOOL lockFileExResult;
 
@@ -1082,6 +1086,67 @@ TEST_F(CompilerCacheWindowsTest, givenCacheBinaryWhenRenameTempFileBinaryToPrope
     EXPECT_EQ(0u, SysCalls::writeFileCalled);
 }
 
+class CompilerCachePackMockWindows : public CompilerCachePack {
+  public:
+    using CompilerCachePack::CompilerCachePack;
+    using CompilerCachePack::closeTempFile;
+    using CompilerCachePack::createTempFile;
+    using CompilerCachePack::lockPackFile;
+    using CompilerCachePack::tempFilePath;
+    using CompilerCachePack::unlockPackFile;
+};
+
+TEST_F(CompilerCacheWindowsTest, givenMoveFileExAFailureWhenClosingPackTempFileThenOnlyTempFileIsDeletedAndFalseIsReturned) {
+    VariableBackup<size_t> moveFileExACalledBackup(&SysCalls::moveFileExACalled, 0u);
+    VariableBackup<BOOL> moveFileExAResultBackup(&SysCalls::moveFileExAResult, FALSE);
+
+    CompilerCachePackMockWindows pack("C:\\Users\\user1\\cl_cache\\cl_cache.pack", MemoryConstants::megaByte);
+    ASSERT_TRUE(pack.createTempFile());
+    EXPECT_FALSE(pack.closeTempFile(true));
+
+    EXPECT_EQ(1u, SysCalls::moveFileExACalled);
+    ASSERT_EQ(1u, SysCalls::deleteFileACalled);
+    EXPECT_EQ(pack.tempFilePath, SysCalls::deleteFiles[0]);
+}
+
+TEST_F(CompilerCacheWindowsTest, givenMoveFileExASuccessWhenClosingPackTempFileThenNothingIsDeletedAndTrueIsReturned) {
+    VariableBackup<size_t> moveFileExACalledBackup(&SysCalls::moveFileExACalled, 0u);
+
+    CompilerCachePackMockWindows pack("C:\\Users\\user1\\cl_cache\\cl_cache.pack", MemoryConstants::megaByte);
+    ASSERT_TRUE(pack.createTempFile());
+    EXPECT_TRUE(pack.closeTempFile(true));
+
+    EXPECT_EQ(1u, SysCalls::moveFileExACalled);
+    EXPECT_EQ(0u, SysCalls::deleteFileACalled);
+}
+
+TEST_F(CompilerCacheWindowsTest, givenLockFileExFailureWhenLockingPackFileThenHandleIsClosedAndFalseIsReturned) {
+    SysCalls::createFileAResults[0] = reinterpret_cast<HANDLE>(0x1234);
+    SysCalls::lockFileExResult = FALSE;
+
+    CompilerCachePackMockWindows pack("C:\\Users\\user1\\cl_cache\\cl_cache.pack", MemoryConstants::megaByte);
+    UnifiedHandle lockHandle{INVALID_HANDLE_VALUE};
+    EXPECT_FALSE(pack.lockPackFile(lockHandle));
+
+    EXPECT_EQ(1u, SysCalls::lockFileExCalled);
+    EXPECT_EQ(1u, SysCalls::closeHandleCalled);
+    EXPECT_EQ(INVALID_HANDLE_VALUE, std::get<void *>(lockHandle));
+}
+
+TEST_F(CompilerCacheWindowsTest, givenPackWhenLockingAndUnlockingPackFileThenLockFileIsLockedUnlockedAndClosed) {
+    SysCalls::createFileAResults[0] = reinterpret_cast<HANDLE>(0x1234);
+
+    CompilerCachePackMockWindows pack("C:\\Users\\user1\\cl_cache\\cl_cache.pack", MemoryConstants::megaByte);
+    UnifiedHandle lockHandle{INVALID_HANDLE_VALUE};
+    EXPECT_TRUE(pack.lockPackFile(lockHandle));
+    EXPECT_EQ(reinterpret_cast<HANDLE>(0x1234), std::get<void *>(lockHandle));
+
+    pack.unlockPackFile(lockHandle);
+    EXPECT_EQ(1u, SysCalls::lockFileExCalled);
+    EXPECT_EQ(1u, SysCalls::unlockFileExCalled);
+    EXPECT_EQ(1u, SysCalls::closeHandleCalled);
+}
+
 TEST(CompilerCacheHelperWindowsTest, givenFindFirstFileASuccessWhenGetFileModificationTimeThenFindCloseIsCalled) {
     VariableBackup<HANDLE> findFirstFileAResultBackup(&SysCalls::findFirstFileAResult, reinterpret_cast<HANDLE>(0x1234));
     VariableBackup<size_t> findCloseCalledBackup(&SysCalls::findCloseCalled, 0u);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,8 @@
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <thread>
+
 using namespace NEO;
 extern ApiSpecificConfig::ApiType apiTypeForUlts;
 namespace NEO {
@@ -1946,4 +1948,59 @@ HWTEST_F(DeviceTests, givenCopyInternalEngineWhenStopDirectSubmissionForCopyEngi
     regularUltCsr->blitterDirectSubmissionAvailable = true;
     device->stopDirectSubmissionForCopyEngine();
     EXPECT_TRUE(regularUltCsr->stopDirectSubmissionCalled);
-}
\ No newline at end of file
+}
+
+HWTEST_F(DeviceTests, givenDeferEngineResourcesCreationWhenCreatingDeviceThenLowPriorityEngineResourcesAreCreatedOnFirstInitialization) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DeferOsContextInitialization.set(1);
+    debugManager.flags.DeferEngineResourcesCreation.set(1);
+    debugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+
+    UltDeviceFactory deviceFactory{1, 0};
+    auto device = deviceFactory.rootDevices[0];
+
+    EXPECT_NE(nullptr, device->getDefaultEngine().commandStreamReceiver->getPreemptionAllocation());
+    EXPECT_FALSE(device->getDefaultEngine().commandStreamReceiver->isEngineResourcesCreationDeferred());
+
+    auto lowPriorityEngine = device->tryGetEngine(device->getDefaultEngine().getEngineType(), EngineUsage::lowPriority);
+    ASSERT_NE(nullptr, lowPriorityEngine);
+    auto csr = lowPriorityEngine->commandStreamReceiver;
+
+    EXPECT_TRUE(csr->isEngineResourcesCreationDeferred());
+    EXPECT_FALSE(csr->isInitialized());
+    EXPECT_NE(nullptr, csr->getTagAddress());
+    EXPECT_EQ(nullptr, csr->getPreemptionAllocation());
+    EXPECT_EQ(nullptr, csr->getGlobalFenceAllocation());
+
+    EXPECT_TRUE(csr->initializeResources(false));
+
+    EXPECT_TRUE(csr->isInitialized());
+    EXPECT_NE(nullptr, csr->getPreemptionAllocation());
+    EXPECT_EQ(device->getGfxCoreHelper().isFenceAllocationRequired(device->getHardwareInfo()), nullptr != csr->getGlobalFenceAllocation());
+}
+
+HWTEST_F(DeviceTests, givenDeferEngineResourcesCreationWhenInitializingEngineFromMultipleThreadsThenResourcesAreCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DeferOsContextInitialization.set(1);
+    debugManager.flags.DeferEngineResourcesCreation.set(1);
+    debugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+
+    UltDeviceFactory deviceFactory{1, 0};
+    auto device = deviceFactory.rootDevices[0];
+
+    auto lowPriorityEngine = device->tryGetEngine(device->getDefaultEngine().getEngineType(), EngineUsage::lowPriority);
+    ASSERT_NE(nullptr, lowPriorityEngine);
+    auto csr = static_cast<UltCommandStreamReceiver<FamilyType> *>(lowPriorityEngine->commandStreamReceiver);
+    csr->fillReusableAllocationsListCalled = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([csr] { EXPECT_TRUE(csr->initializeResources(false)); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1u, csr->fillReusableAllocationsListCalled);
+    EXPECT_NE(nullptr, csr->getPreemptionAllocation());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -116,6 +116,14 @@ TEST(YamlIsSign, GivenCharThenReturnsTrueOnlyWhenCharIsPlusOrMinus) {
     }
 }
 
+TEST(YamlCharacterClassTable, GivenCharThenClassesMatchCharacterPredicates) {
+    for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c) {
+        auto character = static_cast<char>(c);
+        EXPECT_EQ(NEO::Yaml::isNameIdentifierCharacter(character), NEO::Yaml::hasCharacterClass(character, NEO::Yaml::CharacterClass::nameIdentifier)) << c;
+        EXPECT_EQ(NEO::Yaml::isSeparationWhitespace(character), NEO::Yaml::hasCharacterClass(character, NEO::Yaml::CharacterClass::separationWhitespace)) << c;
+    }
+}
+
 TEST(YamlIsSpecificNameIdentifier, WhenTextIsEmptyThenReturnFalse) {
     ConstStringRef text = "a";
     EXPECT_TRUE(NEO::Yaml::isSpecificNameIdentifier(text, text.begin(), "a"));
@@ -729,6 +737,50 @@ TEST(YamlTokenize, GivenEmptyCommentMarkerThenDontCreateEmptyComment) {
     }
 }
 
+TEST(YamlTokenize, GivenCommentAtTheEndOfTextWithoutNewlineThenTokenizeTillEndOfText) {
+    ConstStringRef yaml = "orange :    green # comment";
+
+    NEO::Yaml::Token expectedTokens[] = {
+        Token{"orange", NEO::Yaml::Token::identifier},   // token 0
+        Token{":", NEO::Yaml::Token::singleCharacter},   // token 1
+        Token{"green", NEO::Yaml::Token::literalString}, // token 2
+        Token{"#", NEO::Yaml::Token::singleCharacter},   // token 3
+        Token{" comment", NEO::Yaml::Token::comment},    // token 4
+    };
+
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_FALSE(warnings.empty());
+
+    ASSERT_EQ(1U, lines.size());
+    ASSERT_LE(sizeof(expectedTokens) / sizeof(expectedTokens[0]), tokens.size());
+    for (size_t i = 0; i < sizeof(expectedTokens) / sizeof(expectedTokens[0]); ++i) {
+        EXPECT_EQ(expectedTokens[i], tokens[i]) << i;
+    }
+}
+
+TEST(YamlTokenize, GivenRunOfSpacesAsIndentThenWholeRunIsCountedAsIndent) {
+    ConstStringRef yaml = "a :\n        b : c\n";
+
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_TRUE(warnings.empty()) << warnings;
+
+    ASSERT_EQ(2U, lines.size());
+    EXPECT_EQ(0U, lines[0].indent);
+    EXPECT_EQ(8U, lines[1].indent);
+}
+
 TEST(YamlTokenize, GivenCommentAtTheBeginningOfTheLineThenMarkWholeLineAsComment) {
     ConstStringRef yaml = "#orange : green\n";
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,7 @@
 #include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/worker_pool.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
@@ -77,6 +78,45 @@ TEST(ZeInfoVersionSupportTest, whenCheckingSupportedZeInfoVersionThenProperValue
     EXPECT_TRUE(ZeInfo::isAtLeastZeInfoVersion(srcZeInfoVersion, {3, 13}));
 }
 
+TEST(DecodeZeInfoKernels, givenParallelKernelDecodeThreadsWhenDecodingKernelsThenResultsAreSameAsWithSequentialDecoding) {
+    auto decodeKernels = [](const std::string &zeinfo, int32_t parallelDecodeThreads, NEO::ProgramInfo &programInfo, std::string &errors, std::string &warnings) {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.ParallelKernelDecodeThreads.set(parallelDecodeThreads);
+        NEO::Yaml::YamlParser parser;
+        EXPECT_TRUE(parser.parse(zeinfo, errors, warnings));
+        ZeInfo::ZeInfoSections zeInfoSections{};
+        EXPECT_EQ(DecodeError::success, ZeInfo::extractZeInfoSections(parser, zeInfoSections, errors, warnings));
+        return ZeInfo::decodeZeInfoKernels(programInfo, parser, zeInfoSections, errors, warnings, ZeInfo::zeInfoDecoderVersion);
+    };
+
+    for (const auto &invalidKernelIds : {std::vector<uint32_t>{}, std::vector<uint32_t>{5U, 9U}}) {
+        std::string zeinfo = "kernels:\n";
+        for (uint32_t kernelId = 0U; kernelId < 2 * ZeInfo::minKernelsCountForParallelDecode; kernelId++) {
+            bool isInvalid = std::find(invalidKernelIds.begin(), invalidKernelIds.end(), kernelId) != invalidKernelIds.end();
+            auto simdSize = isInvalid ? "7" : "8";
+            zeinfo += "  - name : kernel_" + std::to_string(kernelId) + "\n    execution_env:\n      simd_size: " + simdSize + "\n";
+        }
+
+        NEO::WorkerPool workerPool(3u);
+        NEO::ProgramInfo sequentialProgramInfo, parallelProgramInfo;
+        sequentialProgramInfo.workerPool = &workerPool;
+        parallelProgramInfo.workerPool = &workerPool;
+        std::string sequentialErrors, sequentialWarnings, parallelErrors, parallelWarnings;
+        auto sequentialErr = decodeKernels(zeinfo, 0, sequentialProgramInfo, sequentialErrors, sequentialWarnings);
+        auto parallelErr = decodeKernels(zeinfo, 4, parallelProgramInfo, parallelErrors, parallelWarnings);
+
+        EXPECT_EQ(invalidKernelIds.empty() ? DecodeError::success : DecodeError::invalidBinary, sequentialErr);
+        EXPECT_EQ(sequentialErr, parallelErr);
+        EXPECT_EQ(sequentialErrors, parallelErrors);
+        EXPECT_EQ(sequentialWarnings, parallelWarnings);
+        ASSERT_EQ(sequentialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+        for (size_t i = 0; i < parallelProgramInfo.kernelInfos.size(); i++) {
+            EXPECT_EQ(sequentialProgramInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName, parallelProgramInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+            EXPECT_EQ(sequentialProgramInfo.kernelInfos[i]->kernelDescriptor.kernelAttributes.simdSize, parallelProgramInfo.kernelInfos[i]->kernelDescriptor.kernelAttributes.simdSize);
+        }
+    }
+}
+
 TEST(ZebinValidateTargetTest, givenTargetDeviceCreatedUsingHelperFunctionWhenValidatingAgainstAdjustedHwInfoForIgcThenSuccessIsReturned) {
     MockExecutionEnvironment executionEnvironment;
     auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[0];
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -541,6 +541,68 @@ TEST_F(BindlessHeapsHelperTests, givenFreeSlotsInReusePoolForONeSizeWhenAllocati
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[allocatePoolIndex][1].size(), 0u);
 }
 
+TEST_F(BindlessHeapsHelperTests, givenOnlyImageSlotsInReusePoolWhenAllocatingSingleSlotThenImageSlotsAreSplitAndReused) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    bindlessHeapHelper->reuseSlotCountThreshold = 1;
+
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    SurfaceStateInHeapInfo imageSlots[2];
+    imageSlots[0] = bindlessHeapHelper->allocateSSInHeap(NEO::BindlessImageSlot::max * size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    imageSlots[1] = bindlessHeapHelper->allocateSSInHeap(NEO::BindlessImageSlot::max * size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+
+    bindlessHeapHelper->releaseSSToReusePool(imageSlots[0]);
+    bindlessHeapHelper->releaseSSToReusePool(imageSlots[1]);
+
+    auto usedBefore = bindlessHeapHelper->globalSsh->getUsed();
+
+    auto firstSlot = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    auto secondSlot = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+
+    EXPECT_EQ(usedBefore, bindlessHeapHelper->globalSsh->getUsed());
+    EXPECT_EQ(imageSlots[1].surfaceStateOffset, firstSlot.surfaceStateOffset);
+    EXPECT_EQ(size, firstSlot.ssSize);
+    EXPECT_EQ(imageSlots[1].surfaceStateOffset + size, secondSlot.surfaceStateOffset);
+    EXPECT_EQ(ptrOffset(imageSlots[1].ssPtr, size), secondSlot.ssPtr);
+
+    auto allocatePoolIndex = bindlessHeapHelper->allocatePoolIndex;
+    EXPECT_EQ(2u, bindlessHeapHelper->surfaceStateInHeapVectorReuse[allocatePoolIndex][0].size());
+    EXPECT_EQ(1u, bindlessHeapHelper->surfaceStateInHeapVectorReuse[allocatePoolIndex][1].size());
+
+    auto occupancy = bindlessHeapHelper->getHeapsOccupancy();
+    EXPECT_EQ(2u, occupancy.reusedSlotsCount);
+    EXPECT_EQ(1u, occupancy.splitSlotsCount);
+    EXPECT_EQ(2 * size + NEO::BindlessImageSlot::max * size, occupancy.reusePoolsSize);
+}
+
+TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenHeapGrowsThenOccupancyIncludesRetiredHeaps) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    auto occupancyBefore = bindlessHeapHelper->getHeapsOccupancy();
+
+    bindlessHeapHelper->globalSsh->getSpace(bindlessHeapHelper->globalSsh->getAvailableSpace());
+    auto retiredHeapSize = bindlessHeapHelper->globalSsh->getUsed();
+    bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+
+    auto occupancyAfter = bindlessHeapHelper->getHeapsOccupancy();
+    EXPECT_GT(occupancyAfter.heapsAllocatedSize, occupancyBefore.heapsAllocatedSize);
+    EXPECT_EQ(occupancyBefore.heapsUsedSize + retiredHeapSize, occupancyAfter.heapsUsedSize);
+    EXPECT_EQ(0u, occupancyAfter.reusePoolsSize);
+}
+
+TEST_F(BindlessHeapsHelperTests, givenPrintBindlessHeapsOccupancyWhenBindlessHeapHelperIsDestroyedThenOccupancyIsPrinted) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.PrintBindlessHeapsOccupancy.set(true);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+
+    testing::internal::CaptureStdout();
+    bindlessHeapHelper.reset();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Bindless heaps occupancy for root device"));
+}
+
 TEST_F(BindlessHeapsHelperTests, givenBindlessHelperWhenGettingAndClearingDirstyStateForContextThenCorrectFlagIsReturnedAdCleard) {
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
 
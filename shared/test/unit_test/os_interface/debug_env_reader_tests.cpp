@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -487,4 +487,45 @@ TEST_F(DebugEnvReaderTests, givenEnvironmentVariableReaderWhenCreateOsReaderWith
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, ""));
     EXPECT_NE(nullptr, settingsReader);
 }
+
+TEST(EnvironmentSnapshotReaderTests, givenEnvironmentWhenReadingSettingsThenValuesComeFromSnapshotWithoutGetenvCalls) {
+    VariableBackup<ApiSpecificConfig::ApiType> backup(&apiTypeForUlts, ApiSpecificConfig::L0);
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+    const char *environment[] = {"PATH=/usr/bin", "NEO_L0_TestingVariable=1234", "NEO_TestingString=Expected=Value", "TestingUnprefixed=7", "InvalidEntry", nullptr};
+
+    EnvironmentSnapshotReader reader(environment);
+    EXPECT_EQ(4u, reader.getVariablesCount());
+    EXPECT_TRUE(reader.arePrefixedVariablesPresent());
+
+    DebugVarPrefix type = DebugVarPrefix::none;
+    EXPECT_EQ(1234, reader.getSetting("TestingVariable", 1, type));
+    EXPECT_EQ(DebugVarPrefix::neoL0, type);
+
+    EXPECT_EQ("Expected=Value", reader.getSetting("TestingString", std::string("Default"), type));
+    EXPECT_EQ(DebugVarPrefix::neo, type);
+
+    EXPECT_EQ(7, reader.getSetting("TestingUnprefixed", 1, type));
+    EXPECT_EQ(DebugVarPrefix::none, type);
+
+    EXPECT_EQ(1, reader.getSetting("NotSetVariable", 1, type));
+    EXPECT_EQ(DebugVarPrefix::none, type);
+    EXPECT_EQ(0u, IoFunctions::mockGetenvCalled);
+}
+
+TEST(EnvironmentSnapshotReaderTests, givenEnvironmentWithoutPrefixedVariablesWhenReadingSettingThenOnlyUnprefixedNameIsUsed) {
+    VariableBackup<ApiSpecificConfig::ApiType> backup(&apiTypeForUlts, ApiSpecificConfig::L0);
+    const char *environment[] = {"TestingVariable=5", nullptr};
+
+    EnvironmentSnapshotReader reader(environment);
+    EXPECT_FALSE(reader.arePrefixedVariablesPresent());
+
+    DebugVarPrefix type = DebugVarPrefix::neo;
+    EXPECT_TRUE(reader.getSetting("TestingVariable", false, type));
+    EXPECT_EQ(DebugVarPrefix::none, type);
+    EXPECT_EQ(5, reader.getSetting("TestingVariable", static_cast<int64_t>(0)));
+
+    EnvironmentSnapshotReader emptyReader(nullptr);
+    EXPECT_EQ(0u, emptyReader.getVariablesCount());
+    EXPECT_EQ("Default", emptyReader.getSetting("TestingVariable", std::string("Default")));
+}
 } // namespace NEO
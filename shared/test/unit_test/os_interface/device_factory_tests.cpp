@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/release_helper/release_helper.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -176,6 +177,58 @@ TEST_F(DeviceFactoryTests, givenMultipleDevicesWhenInitializeResourcesFailsForAl
     EXPECT_EQ(0u, executionEnvironment.rootDeviceEnvironments.size());
 }
 
+TEST_F(DeviceFactoryTests, givenParallelRootDeviceInitializationWhenInitializeResourcesFailsForOneDeviceThenEachDeviceIsInitializedOnceAndFailedEnvironmentIsRemoved) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CreateMultipleRootDevices.set(3);
+    debugManager.flags.ParallelRootDeviceInitialization.set(1);
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), true, 3u);
+
+    EXPECT_EQ(3u, executionEnvironment.rootDeviceEnvironments.size());
+    auto rootDeviceEnvironment0 = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[0].get());
+    auto rootDeviceEnvironment1 = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[1].get());
+    auto rootDeviceEnvironment2 = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[2].get());
+
+    rootDeviceEnvironment0->initOsInterfaceResults.push_back(true);
+    rootDeviceEnvironment0->initOsInterfaceExpectedCallCount = 1u;
+    rootDeviceEnvironment1->initOsInterfaceResults.push_back(false);
+    rootDeviceEnvironment1->initOsInterfaceExpectedCallCount = 1u;
+    rootDeviceEnvironment2->initOsInterfaceResults.push_back(true);
+    rootDeviceEnvironment2->initOsInterfaceExpectedCallCount = 1u;
+
+    bool success = DeviceFactory::prepareDeviceEnvironments(executionEnvironment);
+    ASSERT_TRUE(success);
+
+    ASSERT_EQ(2u, executionEnvironment.rootDeviceEnvironments.size());
+    std::vector<RootDeviceEnvironment *> remainingEnvironments = {executionEnvironment.rootDeviceEnvironments[0].get(), executionEnvironment.rootDeviceEnvironments[1].get()};
+    EXPECT_NE(remainingEnvironments.end(), std::find(remainingEnvironments.begin(), remainingEnvironments.end(), rootDeviceEnvironment0));
+    EXPECT_NE(remainingEnvironments.end(), std::find(remainingEnvironments.begin(), remainingEnvironments.end(), rootDeviceEnvironment2));
+    EXPECT_EQ(1u, rootDeviceEnvironment0->initOsInterfaceCalled);
+    EXPECT_EQ(1u, rootDeviceEnvironment2->initOsInterfaceCalled);
+}
+
+TEST_F(DeviceFactoryTests, givenStartupPhaseHookWhenPreparingDeviceEnvironmentsThenDiscoveryAndPerDevicePhasesAreReported) {
+    static std::vector<std::pair<std::string, uint32_t>> reportedPhases;
+    reportedPhases.clear();
+    VariableBackup<decltype(DeviceFactory::startupPhaseCompletedFunc)> hookBackup(&DeviceFactory::startupPhaseCompletedFunc, [](const char *phaseName, uint32_t rootDeviceIndex, uint64_t durationNs) -> void {
+        reportedPhases.emplace_back(phaseName, rootDeviceIndex);
+    });
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CreateMultipleRootDevices.set(2);
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), true, 2u);
+
+    bool success = DeviceFactory::prepareDeviceEnvironments(executionEnvironment);
+    ASSERT_TRUE(success);
+
+    const std::vector<std::pair<std::string, uint32_t>> expectedPhases = {
+        {"discoverDevices", DeviceFactory::allRootDevices},
+        {"initOsInterface", 0u},
+        {"initGmm", 0u},
+        {"initOsInterface", 1u},
+        {"initGmm", 1u}};
+    EXPECT_EQ(expectedPhases, reportedPhases);
+}
+
 TEST_F(DeviceFactoryTests, givenFailedAilInitializationResultWhenPrepareDeviceEnvironmentsIsCalledThenReturnFalse) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
     auto mockRootDeviceEnvironment = static_cast<MockRootDeviceEnvironment *>(executionEnvironment.rootDeviceEnvironments[0].get());
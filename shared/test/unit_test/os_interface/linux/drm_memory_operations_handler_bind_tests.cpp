@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,9 +31,11 @@
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_gmm_client_context.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture_prelim.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <array>
 #include <memory>
 
 using namespace NEO;
@@ -1433,6 +1435,118 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenDrmMemoryOperationBindWhenCallin
 
 using DrmResidencyHandlerTests = ::testing::Test;
 
+struct AllocationTypeCountingMemoryManager : public MockMemoryManager {
+    using MockMemoryManager::MockMemoryManager;
+
+    GraphicsAllocation *allocateGraphicsMemoryWithProperties(const AllocationProperties &properties) override {
+        allocationsCount[static_cast<size_t>(properties.allocationType)]++;
+        return MockMemoryManager::allocateGraphicsMemoryWithProperties(properties);
+    }
+
+    uint32_t getAllocationsCount(AllocationType allocationType) const {
+        return allocationsCount[static_cast<size_t>(allocationType)];
+    }
+
+    std::array<uint32_t, static_cast<size_t>(AllocationType::count)> allocationsCount = {};
+};
+
+struct DrmResidencyHandlerDeferredEnginesTests : public ::testing::Test {
+    void SetUp() override {
+        debugManager.flags.DeferOsContextInitialization.set(1);
+        debugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+    }
+
+    void createDeviceWithSixteenEngines() {
+        hwInfo = *defaultHwInfo;
+        hwInfo.featureTable.flags.ftrCCSNode = true;
+        hwInfo.gtSystemInfo.CCSInfo.NumberOfCCSEnabled = 4;
+        hwInfo.capabilityTable.blitterOperationsSupported = true;
+        hwInfo.featureTable.ftrBcsInfo = maxNBitValue(9);
+
+        executionEnvironment = new ExecutionEnvironment;
+        executionEnvironment->prepareRootDeviceEnvironments(1);
+        auto &rootDeviceEnvironment = *executionEnvironment->rootDeviceEnvironments[0];
+        rootDeviceEnvironment.setHwInfoAndInitHelpers(&hwInfo);
+        rootDeviceEnvironment.initGmm();
+        executionEnvironment->calculateMaxOsContextCount();
+
+        drm = new DrmQueryMock(rootDeviceEnvironment);
+        drm->setBindAvailable();
+        rootDeviceEnvironment.osInterface = std::make_unique<OSInterface>();
+        rootDeviceEnvironment.osInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
+        operationHandler = new MockDrmMemoryOperationsHandlerBind(rootDeviceEnvironment, 0u);
+        rootDeviceEnvironment.memoryOperationsInterface.reset(operationHandler);
+        countingMemoryManager = new AllocationTypeCountingMemoryManager(*executionEnvironment);
+        executionEnvironment->memoryManager.reset(countingMemoryManager);
+
+        device.reset(MockDevice::createWithExecutionEnvironment<MockDevice>(&hwInfo, executionEnvironment, 0u));
+    }
+
+    uint32_t getInitializedEnginesCount() const {
+        uint32_t initializedEnginesCount = 0;
+        for (const auto &engine : device->getAllEngines()) {
+            initializedEnginesCount += engine.osContext->isInitialized() ? 1 : 0;
+        }
+        return initializedEnginesCount;
+    }
+
+    DebugManagerStateRestore restorer;
+    HardwareInfo hwInfo{};
+    ExecutionEnvironment *executionEnvironment = nullptr;
+    DrmQueryMock *drm = nullptr;
+    MockDrmMemoryOperationsHandlerBind *operationHandler = nullptr;
+    AllocationTypeCountingMemoryManager *countingMemoryManager = nullptr;
+    std::unique_ptr<MockDevice> device;
+};
+
+HWTEST2_F(DrmResidencyHandlerDeferredEnginesTests, givenDeferredEngineResourcesOnDeviceWithSixteenEnginesWhenCreatingDeviceAndMakingMemoryResidentThenOnlyInitializedEnginesAllocateResources, IsXeHpcCore) {
+    debugManager.flags.DeferEngineResourcesCreation.set(1);
+    createDeviceWithSixteenEngines();
+    auto &engines = device->getAllEngines();
+    ASSERT_LE(16u, engines.size());
+
+    for (const auto &engine : engines) {
+        EXPECT_NE(engine.osContext->isInitialized(), engine.commandStreamReceiver->isEngineResourcesCreationDeferred());
+    }
+    const auto initializedEnginesCount = getInitializedEnginesCount();
+    EXPECT_LT(initializedEnginesCount, engines.size());
+
+    const bool fenceAllocationRequired = device->getGfxCoreHelper().isFenceAllocationRequired(device->getHardwareInfo());
+    EXPECT_EQ(initializedEnginesCount, countingMemoryManager->getAllocationsCount(AllocationType::preemption));
+    EXPECT_EQ(fenceAllocationRequired ? initializedEnginesCount : 0u, countingMemoryManager->getAllocationsCount(AllocationType::globalFence));
+
+    TestedDrmMemoryManager drmMemoryManager(*executionEnvironment);
+    auto allocation = drmMemoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{0u, MemoryConstants::pageSize});
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(&allocation, 1), false));
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->isResident(device.get(), *allocation));
+    EXPECT_EQ(1u, drm->context.vmBindCalled);
+
+    EXPECT_EQ(initializedEnginesCount, getInitializedEnginesCount());
+    EXPECT_EQ(initializedEnginesCount, countingMemoryManager->getAllocationsCount(AllocationType::preemption));
+
+    drmMemoryManager.freeGraphicsMemory(allocation);
+}
+
+HWTEST2_F(DrmResidencyHandlerDeferredEnginesTests, givenDeferredOsContextInitializationAndEngineResourcesNotDeferredWhenMakingMemoryResidentThenAllEnginesAreInitialized, IsXeHpcCore) {
+    createDeviceWithSixteenEngines();
+    auto &engines = device->getAllEngines();
+    ASSERT_LE(16u, engines.size());
+
+    for (const auto &engine : engines) {
+        EXPECT_FALSE(engine.commandStreamReceiver->isEngineResourcesCreationDeferred());
+    }
+    EXPECT_LT(getInitializedEnginesCount(), engines.size());
+
+    TestedDrmMemoryManager drmMemoryManager(*executionEnvironment);
+    auto allocation = drmMemoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{0u, MemoryConstants::pageSize});
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResident(device.get(), ArrayRef<GraphicsAllocation *>(&allocation, 1), false));
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->isResident(device.get(), *allocation));
+
+    EXPECT_EQ(engines.size(), getInitializedEnginesCount());
+
+    drmMemoryManager.freeGraphicsMemory(allocation);
+}
+
 HWTEST2_F(DrmResidencyHandlerTests, givenClosIndexAndMemoryTypeWhenAskingForPatIndexThenReturnCorrectValue, IsWithinXeGfxFamily) {
     MockExecutionEnvironment mockExecutionEnvironment{};
     auto &productHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<ProductHelper>();
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/system_info.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/linux/drm_mock.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/os_interface/linux/drm_mock_device_blob.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+struct MockDrmQueryCache : public DrmQueryCache {
+    MockDrmQueryCache(const std::string &key, std::vector<uint8_t> &file) : DrmQueryCache("drm_query.bin", key), file(file) {}
+
+    const uint8_t *mapFile(size_t &fileSize) override {
+        mapFileCalled++;
+        fileSize = file.size();
+        return file.empty() ? nullptr : file.data();
+    }
+
+    void unmapFile(const uint8_t *fileData, size_t fileSize) override {
+        unmapFileCalled++;
+    }
+
+    bool writeFile(const std::vector<uint8_t> &fileData) override {
+        writeFileCalled++;
+        file = fileData;
+        return true;
+    }
+
+    std::vector<uint8_t> &file;
+    uint32_t mapFileCalled = 0;
+    uint32_t unmapFileCalled = 0;
+    uint32_t writeFileCalled = 0;
+};
+} // namespace
+
+TEST(DrmQueryCacheTest, givenStoredQueriesWhenSnapshotIsSavedAndLoadedWithSameKeyThenQueriesAreFoundInMappedFile) {
+    std::vector<uint8_t> file;
+    const uint64_t engines[] = {1u, 2u, 3u};
+    const uint32_t topology[] = {4u, 5u};
+
+    {
+        MockDrmQueryCache queryCache("device:1", file);
+        EXPECT_FALSE(queryCache.load());
+        queryCache.store(1u, 0u, engines, sizeof(engines));
+        queryCache.store(2u, 0x100u, topology, sizeof(topology));
+        EXPECT_TRUE(queryCache.save());
+        EXPECT_EQ(1u, queryCache.writeFileCalled);
+    }
+
+    MockDrmQueryCache queryCache("device:1", file);
+    EXPECT_TRUE(queryCache.load());
+    EXPECT_EQ(2u, queryCache.getEntriesCount());
+
+    const void *data = nullptr;
+    size_t dataSize = 0;
+    EXPECT_TRUE(queryCache.find(1u, 0u, data, dataSize));
+    EXPECT_EQ(sizeof(engines), dataSize);
+    EXPECT_EQ(0, memcmp(engines, data, dataSize));
+    EXPECT_GE(data, static_cast<const void *>(file.data()));
+    EXPECT_LT(data, static_cast<const void *>(file.data() + file.size()));
+
+    EXPECT_TRUE(queryCache.find(2u, 0x100u, data, dataSize));
+    EXPECT_EQ(sizeof(topology), dataSize);
+    EXPECT_EQ(0, memcmp(topology, data, dataSize));
+    EXPECT_FALSE(queryCache.find(2u, 0u, data, dataSize));
+
+    EXPECT_TRUE(queryCache.save());
+    EXPECT_EQ(0u, queryCache.writeFileCalled);
+}
+
+TEST(DrmQueryCacheTest, givenSnapshotWithDifferentKeyOrCorruptedPayloadWhenLoadingThenSnapshotIsRejectedAndRewritten) {
+    std::vector<uint8_t> file;
+    const uint64_t engines[] = {1u, 2u, 3u};
+    {
+        MockDrmQueryCache queryCache("kernel:6.1", file);
+        queryCache.store(1u, 0u, engines, sizeof(engines));
+        queryCache.save();
+    }
+
+    {
+        MockDrmQueryCache queryCache("kernel:6.2", file);
+        EXPECT_FALSE(queryCache.load());
+        EXPECT_EQ(0u, queryCache.getEntriesCount());
+        EXPECT_EQ(1u, queryCache.unmapFileCalled);
+    }
+
+    file.back() ^= 0xffu;
+    MockDrmQueryCache queryCache("kernel:6.1", file);
+    EXPECT_FALSE(queryCache.load());
+    EXPECT_EQ(0u, queryCache.getEntriesCount());
+
+    queryCache.store(1u, 0u, engines, sizeof(engines));
+    EXPECT_TRUE(queryCache.save());
+    EXPECT_EQ(1u, queryCache.writeFileCalled);
+
+    MockDrmQueryCache rewrittenQueryCache("kernel:6.1", file);
+    EXPECT_TRUE(rewrittenQueryCache.load());
+}
+
+TEST(DrmQueryCacheTest, givenQueryCacheWithHwConfigTableWhenQueryingSystemInfoThenSnapshotIsUsedWithoutIoctls) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    std::vector<uint8_t> file;
+    auto queryCache = std::make_unique<MockDrmQueryCache>("device:1", file);
+    auto request = drm.getIoctlHelper()->getDrmParamValue(DrmParam::queryHwconfigTable);
+    queryCache->store(request, 0u, dummyDeviceBlobData, sizeof(dummyDeviceBlobData));
+    drm.queryCache = std::move(queryCache);
+
+    auto ioctlCount = drm.ioctlCount.total.load();
+    EXPECT_TRUE(drm.querySystemInfo());
+    EXPECT_NE(nullptr, drm.getSystemInfo());
+    EXPECT_EQ(ioctlCount, drm.ioctlCount.total.load());
+
+    drm.releaseQueryCache();
+    EXPECT_EQ(nullptr, drm.queryCache);
+    EXPECT_FALSE(file.empty());
+}
+
+TEST(DrmQueryCacheTest, givenQueryCacheWithMemoryRegionsWhenQueryingMemoryRegionsThenKernelIsQueriedAndSnapshotIsNotUpdated) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    std::vector<uint8_t> file;
+    auto queryCache = std::make_unique<MockDrmQueryCache>("device:1", file);
+    auto request = drm.getIoctlHelper()->getDrmParamValue(DrmParam::queryMemoryRegions);
+    const uint64_t memoryRegions[] = {1u, 2u};
+    queryCache->store(request, 0u, memoryRegions, sizeof(memoryRegions));
+    auto queryCachePtr = queryCache.get();
+    drm.queryCache = std::move(queryCache);
+
+    auto ioctlCount = drm.ioctlCount.total.load();
+    drm.query<uint64_t>(request, 0u);
+    EXPECT_LT(ioctlCount, drm.ioctlCount.total.load());
+
+    const void *data = nullptr;
+    size_t dataSize = 0;
+    EXPECT_TRUE(queryCachePtr->find(request, 0u, data, dataSize));
+    EXPECT_EQ(sizeof(memoryRegions), dataSize);
+    EXPECT_EQ(0, memcmp(memoryRegions, data, dataSize));
+}
+
+TEST(DrmQueryCacheTest, givenFailingWriteOrRenameWhenSavingSnapshotThenTemporaryFileIsUnlinked) {
+    VariableBackup<int> unlinkCalledBackup(&SysCalls::unlinkCalled, 0);
+    VariableBackup<int> renameCalledBackup(&SysCalls::renameCalled, 0);
+    const uint64_t engines[] = {1u, 2u, 3u};
+
+    DrmQueryCache queryCache("drm_query.bin", "device:1");
+    queryCache.store(1u, 0u, engines, sizeof(engines));
+    EXPECT_FALSE(queryCache.save());
+    EXPECT_EQ(0, SysCalls::renameCalled);
+    EXPECT_EQ(1, SysCalls::unlinkCalled);
+
+    VariableBackup<decltype(SysCalls::sysCallsWrite)> writeBackup(&SysCalls::sysCallsWrite, [](int fd, const void *buf, size_t count) -> ssize_t {
+        return static_cast<ssize_t>(count);
+    });
+    VariableBackup<decltype(SysCalls::sysCallsRename)> renameBackup(&SysCalls::sysCallsRename, [](const char *currName, const char *dstName) -> int {
+        return -1;
+    });
+    EXPECT_FALSE(queryCache.save());
+    EXPECT_EQ(1, SysCalls::renameCalled);
+    EXPECT_EQ(2, SysCalls::unlinkCalled);
+}
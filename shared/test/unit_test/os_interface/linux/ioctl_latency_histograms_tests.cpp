@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/ioctl_latency_histograms.h"
+#include "shared/test/common/helpers/gtest_helpers.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+
+using namespace NEO;
+
+TEST(IoctlLatencyHistogramsTest, givenLatenciesWhenGettingBucketsThenBucketsAreContiguousAndBoundLatencyWithinSubBucketPrecision) {
+    for (uint64_t timeNs = 0; timeNs < 4096u; timeNs++) {
+        auto bucketIndex = IoctlLatencyHistograms::getBucketIndex(timeNs);
+        EXPECT_LE(IoctlLatencyHistograms::getBucketLowerBound(bucketIndex), timeNs);
+        EXPECT_GT(IoctlLatencyHistograms::getBucketUpperBound(bucketIndex), timeNs);
+    }
+    for (uint32_t bucketIndex = 0; bucketIndex + 1 < IoctlLatencyHistograms::bucketsCount; bucketIndex++) {
+        EXPECT_EQ(IoctlLatencyHistograms::getBucketUpperBound(bucketIndex), IoctlLatencyHistograms::getBucketLowerBound(bucketIndex + 1));
+    }
+
+    auto bucketIndex = IoctlLatencyHistograms::getBucketIndex(1000000u);
+    auto lowerBound = IoctlLatencyHistograms::getBucketLowerBound(bucketIndex);
+    EXPECT_LE(IoctlLatencyHistograms::getBucketUpperBound(bucketIndex) - lowerBound, lowerBound / IoctlLatencyHistograms::subBucketsCount);
+
+    EXPECT_EQ(IoctlLatencyHistograms::overflowBucketIndex - 1, IoctlLatencyHistograms::getBucketIndex((1ull << IoctlLatencyHistograms::maxExponent) - 1));
+    EXPECT_EQ(1ull << IoctlLatencyHistograms::maxExponent, IoctlLatencyHistograms::getBucketUpperBound(IoctlLatencyHistograms::overflowBucketIndex - 1));
+}
+
+TEST(IoctlLatencyHistogramsTest, givenLatencyOfAtLeast2To40NsWhenGettingBucketThenOverflowBucketIsReturned) {
+    EXPECT_EQ(IoctlLatencyHistograms::bucketsCount - 1, IoctlLatencyHistograms::overflowBucketIndex);
+    EXPECT_EQ(IoctlLatencyHistograms::overflowBucketIndex, IoctlLatencyHistograms::getBucketIndex(1ull << IoctlLatencyHistograms::maxExponent));
+    EXPECT_EQ(IoctlLatencyHistograms::overflowBucketIndex, IoctlLatencyHistograms::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(1ull << IoctlLatencyHistograms::maxExponent, IoctlLatencyHistograms::getBucketLowerBound(IoctlLatencyHistograms::overflowBucketIndex));
+    EXPECT_EQ(IoctlLatencyHistograms::overflowLatency, IoctlLatencyHistograms::getBucketUpperBound(IoctlLatencyHistograms::overflowBucketIndex));
+}
+
+TEST(IoctlLatencyHistogramsTest, givenRecordedIoctlsWhenGettingPercentilesThenUpperBoundsOfMatchingBucketsAreReturned) {
+    IoctlLatencyHistograms histograms;
+    EXPECT_EQ(0u, histograms.getPercentile(DrmIoctl::gemExecbuffer2, 50));
+
+    for (uint32_t i = 0; i < 98; i++) {
+        histograms.record(DrmIoctl::gemExecbuffer2, 10000u, 0u, 0u, false);
+    }
+    histograms.record(DrmIoctl::gemExecbuffer2, 5u, 0u, 0u, false);
+    histograms.record(DrmIoctl::gemExecbuffer2, 1000000u, 2u, 1u, true);
+
+    const auto &entry = histograms.getEntry(DrmIoctl::gemExecbuffer2);
+    EXPECT_EQ(100u, entry.count.load());
+    EXPECT_EQ(98u * 10000u + 5u + 1000000u, entry.totalTime.load());
+    EXPECT_EQ(2u, entry.retries.load());
+    EXPECT_EQ(1u, entry.interrupts.load());
+    EXPECT_EQ(1u, entry.failures.load());
+    EXPECT_EQ(0u, histograms.getEntry(DrmIoctl::gemVmBind).count.load());
+
+    auto execBufferBucket = IoctlLatencyHistograms::getBucketIndex(10000u);
+    EXPECT_EQ(IoctlLatencyHistograms::getBucketUpperBound(IoctlLatencyHistograms::getBucketIndex(5u)), histograms.getPercentile(DrmIoctl::gemExecbuffer2, 1));
+    EXPECT_EQ(IoctlLatencyHistograms::getBucketUpperBound(execBufferBucket), histograms.getPercentile(DrmIoctl::gemExecbuffer2, 50));
+    EXPECT_EQ(IoctlLatencyHistograms::getBucketUpperBound(execBufferBucket), histograms.getPercentile(DrmIoctl::gemExecbuffer2, 99));
+    EXPECT_EQ(IoctlLatencyHistograms::getBucketUpperBound(IoctlLatencyHistograms::getBucketIndex(1000000u)), histograms.getPercentile(DrmIoctl::gemExecbuffer2, 100));
+}
+
+TEST(IoctlLatencyHistogramsTest, givenOverflowedLatencyWhenGettingPercentilesAndPrintingThenOverflowIsReportedSeparately) {
+    IoctlLatencyHistograms histograms;
+    const auto lastRegularLatency = (1ull << IoctlLatencyHistograms::maxExponent) - 1;
+    for (uint32_t i = 0; i < 99; i++) {
+        histograms.record(DrmIoctl::getparam, lastRegularLatency, 0u, 0u, false);
+    }
+    histograms.record(DrmIoctl::getparam, 1ull << IoctlLatencyHistograms::maxExponent, 0u, 0u, false);
+
+    EXPECT_EQ(99u, histograms.getEntry(DrmIoctl::getparam).buckets[IoctlLatencyHistograms::overflowBucketIndex - 1].load());
+    EXPECT_EQ(1u, histograms.getEntry(DrmIoctl::getparam).buckets[IoctlLatencyHistograms::overflowBucketIndex].load());
+    EXPECT_EQ(1ull << IoctlLatencyHistograms::maxExponent, histograms.getPercentile(DrmIoctl::getparam, 99));
+    EXPECT_EQ(IoctlLatencyHistograms::overflowLatency, histograms.getPercentile(DrmIoctl::getparam, 100));
+
+    ::testing::internal::CaptureStdout();
+    histograms.print(stdout, nullptr);
+    auto output = ::testing::internal::GetCapturedStdout();
+    EXPECT_TRUE(hasSubstr(output, "DRM_IOCTL_I915_GETPARAM"));
+    EXPECT_TRUE(hasSubstr(output, "1099511627776         >= 2^40"));
+    EXPECT_TRUE(hasSubstr(output, "[962072674304, 1099511627776) ns: 99"));
+    EXPECT_TRUE(hasSubstr(output, " >= 2^40 ns: 1\n"));
+}
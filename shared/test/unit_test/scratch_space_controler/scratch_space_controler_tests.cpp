@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,3 +84,105 @@ HWTEST_F(ScratchComtrolerTests, givenNullptrBindlessHeapHelperWhenProgramBindles
     EXPECT_TRUE(static_cast<MockScratchSpaceControllerBase *>(scratchController.get())->programBindlessSurfaceStateForScratchCalled);
     EXPECT_EQ(0u, csr.makeResidentCalledTimes);
 }
+
+HWTEST_F(ScratchComtrolerTests, givenScratchSpaceAllocatedWhenReleasingScratchSpaceThenAllocationIsDeferredForDeletionAndHighWaterMarkIsKept) {
+    MockCommandStreamReceiver csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    ExecutionEnvironment *execEnv = static_cast<ExecutionEnvironment *>(pDevice->getExecutionEnvironment());
+    auto scratchController = std::make_unique<MockScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(),
+                                                                              *execEnv,
+                                                                              *csr.getInternalAllocationStorage());
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    scratchController->setRequiredScratchSpace(nullptr, 0u, 0x400, 0u, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    ASSERT_NE(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+    auto highWaterMark = scratchController->getScratchSpaceHighWaterMark();
+    EXPECT_NE(0u, highWaterMark);
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    scratchController->releaseScratchSpace();
+
+    EXPECT_EQ(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+    EXPECT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
+    EXPECT_EQ(highWaterMark, scratchController->getScratchSpaceHighWaterMark());
+
+    frontEndStateDirty = false;
+    scratchController->setRequiredScratchSpace(nullptr, 0u, 0x400, 0u, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    EXPECT_NE(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+    EXPECT_TRUE(frontEndStateDirty);
+}
+
+HWTEST_F(ScratchComtrolerTests, givenPrintScratchSpaceHighWaterMarkWhenScratchControllerIsDestroyedThenHighWaterMarkIsPrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintScratchSpaceHighWaterMark.set(true);
+
+    MockCommandStreamReceiver csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    ExecutionEnvironment *execEnv = static_cast<ExecutionEnvironment *>(pDevice->getExecutionEnvironment());
+    auto scratchController = std::make_unique<MockScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(),
+                                                                              *execEnv,
+                                                                              *csr.getInternalAllocationStorage());
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    scratchController->setRequiredScratchSpace(nullptr, 0u, 0x400, 0u, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    auto expectedOutput = "Scratch space high-water mark for root device " + std::to_string(pDevice->getRootDeviceIndex()) + ": " +
+                          std::to_string(scratchController->getScratchSpaceHighWaterMark()) + " bytes\n";
+
+    testing::internal::CaptureStdout();
+    scratchController.reset();
+    EXPECT_EQ(expectedOutput, testing::internal::GetCapturedStdout());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenIdleScratchReleaseTimeoutWhenWaitingForIdleEngineWithoutRecentScratchUsageThenScratchSpaceIsReleased) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ScratchSpaceIdleReleaseTimeoutInMilliseconds.set(0);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    if (csr.heaplessModeEnabled) {
+        GTEST_SKIP();
+    }
+    auto scratchController = csr.getScratchSpaceController();
+    std::vector<uint8_t> ssh(MemoryConstants::pageSize64k);
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    csr.setRequiredScratchSizes(0x400, 0u);
+    scratchController->setRequiredScratchSpace(ssh.data(), 0u, csr.getRequiredScratchSlot0Size(), 0u, csr.getOsContext(), gsbaStateDirty, frontEndStateDirty);
+    ASSERT_NE(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+
+    csr.setMediaVFEStateDirty(false);
+    csr.setRequiredScratchSizes(0u, 0u);
+    EXPECT_NE(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+
+    csr.lastScratchSpaceUsageTime = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+    EXPECT_EQ(WaitStatus::ready, csr.waitForTaskCountAndCleanTemporaryAllocationList(csr.peekTaskCount()));
+
+    EXPECT_EQ(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+    EXPECT_EQ(0u, csr.getRequiredScratchSlot0Size());
+    EXPECT_TRUE(csr.getMediaVFEStateDirty());
+    EXPECT_NE(0u, scratchController->getScratchSpaceHighWaterMark());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenIdleScratchReleaseDisabledWhenWaitingForIdleEngineThenScratchSpaceIsKept) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto scratchController = csr.getScratchSpaceController();
+    std::vector<uint8_t> ssh(MemoryConstants::pageSize64k);
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    csr.setRequiredScratchSizes(0x400, 0u);
+    scratchController->setRequiredScratchSpace(ssh.data(), 0u, csr.getRequiredScratchSlot0Size(), 0u, csr.getOsContext(), gsbaStateDirty, frontEndStateDirty);
+    ASSERT_NE(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+
+    csr.lastScratchSpaceUsageTime = std::chrono::steady_clock::now() - std::chrono::hours(1);
+    csr.waitForTaskCountAndCleanTemporaryAllocationList(csr.peekTaskCount());
+
+    EXPECT_NE(nullptr, scratchController->getScratchSpaceSlot0Allocation());
+    EXPECT_EQ(0x400u, csr.getRequiredScratchSlot0Size());
+}
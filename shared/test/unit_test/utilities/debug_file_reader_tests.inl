@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,7 +37,7 @@ class TestSettingsFileReader : public SettingsFileReader {
     }
 
     bool hasSetting(const char *settingName) {
-        std::map<std::string, std::string>::iterator it = settingStringMap.find(std::string(settingName));
+        auto it = settingStringMap.find(std::string(settingName));
         return (it != settingStringMap.end());
     }
 
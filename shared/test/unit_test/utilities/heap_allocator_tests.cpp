@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1453,4 +1453,25 @@ TEST(HeapAllocatorTest, whenGetBaseAddressIsCalledThenReturnInitialBaseAddress)
     size_t smallChunk = 4096;
     EXPECT_NE(0u, heapAllocator.allocate(smallChunk));
     EXPECT_EQ(heapBase, heapAllocator.getBaseAddress());
-}
\ No newline at end of file
+}
+TEST(HeapAllocatorTest, givenFreedChunksWhenGettingLargestFreeChunkSizeThenBiggestOfUnallocatedRangeAndFreedChunksIsReturned) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 16 * MemoryConstants::pageSize;
+
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment);
+    EXPECT_EQ(heapSize, heapAllocator.getLargestFreeChunkSize());
+
+    uint64_t ptrs[4] = {};
+    for (auto &ptr : ptrs) {
+        size_t chunkSize = 3 * MemoryConstants::pageSize;
+        ptr = heapAllocator.allocate(chunkSize);
+        EXPECT_NE(0u, ptr);
+    }
+    EXPECT_EQ(4 * MemoryConstants::pageSize, heapAllocator.getLargestFreeChunkSize());
+
+    heapAllocator.free(ptrs[1], 3 * MemoryConstants::pageSize);
+    EXPECT_EQ(4 * MemoryConstants::pageSize, heapAllocator.getLargestFreeChunkSize());
+
+    heapAllocator.free(ptrs[2], 3 * MemoryConstants::pageSize);
+    EXPECT_EQ(6 * MemoryConstants::pageSize, heapAllocator.getLargestFreeChunkSize());
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/hot_path_counters.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <thread>
+
+using namespace NEO;
+
+TEST(HotPathCountersTest, givenIncrementsFromExitedAndRunningThreadsWhenReadingCountersThenAllIncrementsAreAggregated) {
+    uint64_t valuesBefore[HotPathCounters::Counter::count];
+    HotPathCounters::getAll(valuesBefore);
+
+    auto incrementCounters = [] {
+        for (uint32_t i = 0; i < 100; i++) {
+            HotPathCounters::increment(HotPathCounters::usmPoolHit);
+        }
+        HotPathCounters::increment(HotPathCounters::usmPoolMiss);
+    };
+    std::thread thread0(incrementCounters);
+    std::thread thread1(incrementCounters);
+    thread0.join();
+    thread1.join();
+    incrementCounters();
+
+    EXPECT_EQ(valuesBefore[HotPathCounters::usmPoolHit] + 300u, HotPathCounters::get(HotPathCounters::usmPoolHit));
+    EXPECT_EQ(valuesBefore[HotPathCounters::usmPoolMiss] + 3u, HotPathCounters::get(HotPathCounters::usmPoolMiss));
+
+    uint64_t valuesAfter[HotPathCounters::Counter::count];
+    HotPathCounters::getAll(valuesAfter);
+    EXPECT_EQ(valuesBefore[HotPathCounters::usmPoolHit] + 300u, valuesAfter[HotPathCounters::usmPoolHit]);
+    EXPECT_EQ(valuesBefore[HotPathCounters::drmIoctl], valuesAfter[HotPathCounters::drmIoctl]);
+}
+
+TEST(HotPathCountersTest, givenPrintHotPathCountersWhenExecutionEnvironmentIsDestroyedThenAllCountersArePrinted) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+
+    testing::internal::CaptureStdout();
+    executionEnvironment.reset();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+    debugManager.flags.PrintHotPathCounters.set(true);
+    executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    testing::internal::CaptureStdout();
+    executionEnvironment.reset();
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("Hot path counters:\n"));
+    for (uint32_t i = 0; i < HotPathCounters::Counter::count; i++) {
+        auto name = std::string(HotPathCounters::getName(static_cast<HotPathCounters::Counter>(i))) + ": ";
+        EXPECT_NE(std::string::npos, output.find(name));
+    }
+    EXPECT_STREQ("unknown", HotPathCounters::getName(HotPathCounters::Counter::count));
+}
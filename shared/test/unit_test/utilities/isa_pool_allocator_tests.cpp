@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/test.h"
 
@@ -99,3 +100,107 @@ TEST_F(IsaPoolAllocatorTest, givenIsaPoolAllocatorWhenRequestForLargeAllocationT
     verifySharedIsaAllocation(allocation, 0, requestAllocationSize);
     isaAllocator.freeSharedIsaAllocation(allocation);
 }
+
+TEST_F(IsaPoolAllocatorTest, givenSmallIsaRequestWhenAllocatingThenSeparatePoolWithFineChunkAlignmentIsUsed) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    constexpr size_t smallRequestSize = 100u;
+
+    auto regularAllocation = isaAllocator.requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize);
+    auto smallAllocation1 = isaAllocator.requestGraphicsAllocationForIsa(false, smallRequestSize);
+    auto smallAllocation2 = isaAllocator.requestGraphicsAllocationForIsa(false, smallRequestSize);
+    verifySharedIsaAllocation(smallAllocation1, 0ul, ISAPoolAllocator::smallIsaAllocationAlignment);
+    verifySharedIsaAllocation(smallAllocation2, ISAPoolAllocator::smallIsaAllocationAlignment, ISAPoolAllocator::smallIsaAllocationAlignment);
+    EXPECT_EQ(smallAllocation1->getGraphicsAllocation(), smallAllocation2->getGraphicsAllocation());
+    EXPECT_NE(regularAllocation->getGraphicsAllocation(), smallAllocation1->getGraphicsAllocation());
+
+    auto statistics = isaAllocator.getStatistics();
+    EXPECT_EQ(2u, statistics.poolsCount);
+    EXPECT_EQ(1u, statistics.smallIsaPoolsCount);
+    EXPECT_EQ(MemoryConstants::pageSize + 2 * ISAPoolAllocator::smallIsaAllocationAlignment, statistics.usedSize);
+    EXPECT_LT(0.0, statistics.getFillRatio());
+
+    isaAllocator.freeSharedIsaAllocation(smallAllocation2);
+    isaAllocator.freeSharedIsaAllocation(smallAllocation1);
+    isaAllocator.freeSharedIsaAllocation(regularAllocation);
+
+    statistics = isaAllocator.getStatistics();
+    EXPECT_EQ(MemoryConstants::pageSize + 2 * ISAPoolAllocator::smallIsaAllocationAlignment, statistics.pendingFreeSize);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenSizeClassesDisabledWhenAllocatingSmallIsaThenRegularPoolIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIsaPoolSizeClasses.set(0);
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+
+    auto allocation = isaAllocator.requestGraphicsAllocationForIsa(false, 100u);
+    verifySharedIsaAllocation(allocation, 0ul, MemoryConstants::pageSize);
+    EXPECT_EQ(0u, isaAllocator.getStatistics().smallIsaPoolsCount);
+    isaAllocator.freeSharedIsaAllocation(allocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenEmptyPoolWhenNewPoolIsRequiredThenEmptyPoolIsReleased) {
+    constexpr size_t sharedIsaAllocationSize = MemoryConstants::pageSize2M * 2;
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+
+    auto smallAllocation = isaAllocator.requestGraphicsAllocationForIsa(false, 100u);
+    ASSERT_NE(nullptr, smallAllocation);
+    EXPECT_EQ(1u, isaAllocator.getStatistics().smallIsaPoolsCount);
+    isaAllocator.freeSharedIsaAllocation(smallAllocation);
+
+    auto allocation = isaAllocator.requestGraphicsAllocationForIsa(false, sharedIsaAllocationSize);
+    verifySharedIsaAllocation(allocation, 0ul, sharedIsaAllocationSize);
+
+    auto statistics = isaAllocator.getStatistics();
+    EXPECT_EQ(1u, statistics.releasedPoolsCount);
+    EXPECT_EQ(1u, statistics.poolsCount);
+    EXPECT_EQ(0u, statistics.smallIsaPoolsCount);
+    EXPECT_EQ(sharedIsaAllocationSize, statistics.usedSize);
+    EXPECT_EQ(1.0, statistics.getFillRatio());
+
+    isaAllocator.freeSharedIsaAllocation(allocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenFreedChunkBetweenLiveAllocationsWhenGettingStatisticsThenFragmentationOfFreeMemoryIsReported) {
+    constexpr size_t sharedIsaAllocationSize = MemoryConstants::pageSize2M * 2;
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    EXPECT_EQ(0.0, isaAllocator.getStatistics().getFragmentation());
+
+    auto allocation1 = isaAllocator.requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize);
+    auto allocation2 = isaAllocator.requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize);
+    auto allocation3 = isaAllocator.requestGraphicsAllocationForIsa(false, sharedIsaAllocationSize - 3 * MemoryConstants::pageSize);
+    verifySharedIsaAllocation(allocation3, 2 * MemoryConstants::pageSize, sharedIsaAllocationSize - 3 * MemoryConstants::pageSize);
+
+    auto statistics = isaAllocator.getStatistics();
+    EXPECT_EQ(MemoryConstants::pageSize, statistics.largestFreeChunksSize);
+    EXPECT_EQ(0.0, statistics.getFragmentation());
+
+    // Freed chunk is returned to the pool by drain, when next request does not fit
+    isaAllocator.freeSharedIsaAllocation(allocation2);
+    auto allocation4 = isaAllocator.requestGraphicsAllocationForIsa(false, 2 * MemoryConstants::pageSize);
+    EXPECT_NE(allocation1->getGraphicsAllocation(), allocation4->getGraphicsAllocation());
+
+    statistics = isaAllocator.getStatistics();
+    EXPECT_EQ(2u, statistics.poolsCount);
+    EXPECT_EQ(sharedIsaAllocationSize, statistics.totalSize - statistics.usedSize);
+    EXPECT_EQ(sharedIsaAllocationSize - MemoryConstants::pageSize, statistics.largestFreeChunksSize);
+    EXPECT_LT(0.0, statistics.getFragmentation());
+
+    isaAllocator.freeSharedIsaAllocation(allocation4);
+    isaAllocator.freeSharedIsaAllocation(allocation3);
+    isaAllocator.freeSharedIsaAllocation(allocation1);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenPrintIsaPoolStatisticsWhenDeviceIsDestroyedThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintIsaPoolStatistics.set(true);
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get(), 0u));
+    auto allocation = device->getIsaPoolAllocator().requestGraphicsAllocationForIsa(false, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, allocation);
+    device->getIsaPoolAllocator().freeSharedIsaAllocation(allocation);
+
+    testing::internal::CaptureStdout();
+    device.reset();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("ISA pools for root device 0: pools 1"));
+    EXPECT_NE(std::string::npos, output.find("fragmentation"));
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+
+#include "gtest/gtest.h"
+
+#include <sys/stat.h>
+
+namespace NEO {
+namespace SysCalls {
+extern bool failMmap;
+} // namespace SysCalls
+} // namespace NEO
+
+using namespace NEO;
+
+struct MappedFileLinuxTest : public ::testing::Test {
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> openBackup{&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+                                                                     return SysCalls::fakeFileDescriptor;
+                                                                 }};
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup{&SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+                                                                      buf->st_size = 4096;
+                                                                      return 0;
+                                                                  }};
+    VariableBackup<uint32_t> closeCalledBackup{&SysCalls::closeFuncCalled, 0u};
+    VariableBackup<uint32_t> mmapCalledBackup{&SysCalls::mmapFuncCalled, 0u};
+    VariableBackup<uint32_t> munmapCalledBackup{&SysCalls::munmapFuncCalled, 0u};
+};
+
+TEST_F(MappedFileLinuxTest, givenExistingFileWhenMappingThenWholeFileIsMappedAndDescriptorIsClosed) {
+    auto mappedFile = MappedFile::map("file.bin");
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_TRUE(mappedFile->isMemoryMapped());
+    EXPECT_EQ(4096u, mappedFile->getData().size());
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+
+    mappedFile.reset();
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+}
+
+TEST_F(MappedFileLinuxTest, givenOpenFailureWhenMappingThenNullptrIsReturned) {
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> failedOpenBackup(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return -1;
+    });
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(0u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(0u, SysCalls::closeFuncCalled);
+}
+
+TEST_F(MappedFileLinuxTest, givenFstatFailureWhenMappingThenNullptrIsReturnedAndDescriptorIsClosed) {
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> failedFstatBackup(&SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        return -1;
+    });
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(0u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+}
+
+TEST_F(MappedFileLinuxTest, givenMmapFailureWhenMappingThenNullptrIsReturnedAndDescriptorIsClosed) {
+    VariableBackup<bool> failMmapBackup(&SysCalls::failMmap, true);
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+}
+
+TEST_F(MappedFileLinuxTest, givenEmptyFileWhenMappingThenEmptyViewIsReturnedWithoutMapping) {
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> emptyFileFstatBackup(&SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        buf->st_size = 0;
+        return 0;
+    });
+    auto mappedFile = MappedFile::map("file.bin");
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_FALSE(mappedFile->isMemoryMapped());
+    EXPECT_TRUE(mappedFile->getData().empty());
+    EXPECT_EQ(0u, SysCalls::mmapFuncCalled);
+
+    mappedFile.reset();
+    EXPECT_EQ(0u, SysCalls::munmapFuncCalled);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/lz_compression.h"
+#include "shared/source/utilities/worker_pool.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cstring>
+#include <random>
+
+using namespace NEO;
+
+namespace {
+std::vector<char> createCompressibleData(size_t size) {
+    std::vector<char> data(size);
+    const char pattern[] = "kernel_binary_section_";
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (i % 97 == 0) ? static_cast<char>(i) : pattern[i % (sizeof(pattern) - 1)];
+    }
+    return data;
+}
+} // namespace
+
+TEST(LzCompressionTests, givenCompressibleDataWhenCompressedAndDecompressedThenDataIsRestoredAndCompressedDataIsSmaller) {
+    auto data = createCompressibleData(100 * MemoryConstants::kiloByte);
+
+    auto compressed = LzCompression::compress(data.data(), data.size(), LzCompression::defaultBlockSize);
+    EXPECT_TRUE(LzCompression::isCompressed(compressed.data(), compressed.size()));
+    EXPECT_LT(compressed.size(), data.size() / 3);
+
+    size_t decompressedSize = 0;
+    auto decompressed = LzCompression::decompress(compressed.data(), compressed.size(), decompressedSize, 1u, nullptr);
+    ASSERT_NE(nullptr, decompressed);
+    ASSERT_EQ(data.size(), decompressedSize);
+    EXPECT_EQ(0, memcmp(data.data(), decompressed.get(), decompressedSize));
+}
+
+TEST(LzCompressionTests, givenIncompressibleDataWhenCompressedThenBlocksAreStoredAndDataIsRestored) {
+    std::vector<char> data(8 * MemoryConstants::kiloByte);
+    std::mt19937 generator(0);
+    for (auto &byte : data) {
+        byte = static_cast<char>(generator());
+    }
+
+    auto compressed = LzCompression::compress(data.data(), data.size(), 1024u);
+    EXPECT_EQ(sizeof(LzCompression::ContainerHeader) + data.size() + 8 * sizeof(uint32_t), compressed.size());
+
+    size_t decompressedSize = 0;
+    auto decompressed = LzCompression::decompress(compressed.data(), compressed.size(), decompressedSize, 1u, nullptr);
+    ASSERT_NE(nullptr, decompressed);
+    ASSERT_EQ(data.size(), decompressedSize);
+    EXPECT_EQ(0, memcmp(data.data(), decompressed.get(), decompressedSize));
+}
+
+TEST(LzCompressionTests, givenDataSpanningManyBlocksWhenDecompressingOnWorkerPoolThenDataIsRestored) {
+    auto data = createCompressibleData(LzCompression::minSizeForParallelDecompression + 123);
+
+    auto compressed = LzCompression::compress(data.data(), data.size(), 64 * MemoryConstants::kiloByte);
+
+    size_t decompressedSize = 0;
+    WorkerPool workerPool(3u);
+    auto decompressed = LzCompression::decompress(compressed.data(), compressed.size(), decompressedSize, LzCompression::maxDecompressionThreads, &workerPool);
+    ASSERT_NE(nullptr, decompressed);
+    ASSERT_EQ(data.size(), decompressedSize);
+    EXPECT_EQ(0, memcmp(data.data(), decompressed.get(), decompressedSize));
+}
+
+TEST(LzCompressionTests, givenTruncatedOrInvalidDataWhenDecompressingThenNullIsReturned) {
+    auto data = createCompressibleData(16 * MemoryConstants::kiloByte);
+    auto compressed = LzCompression::compress(data.data(), data.size(), LzCompression::defaultBlockSize);
+
+    size_t decompressedSize = 0;
+    EXPECT_EQ(nullptr, LzCompression::decompress(compressed.data(), compressed.size() - 1, decompressedSize, 1u, nullptr));
+    EXPECT_EQ(0u, decompressedSize);
+
+    EXPECT_EQ(nullptr, LzCompression::decompress(data.data(), data.size(), decompressedSize, 1u, nullptr));
+    EXPECT_FALSE(LzCompression::isCompressed(data.data(), data.size()));
+    EXPECT_FALSE(LzCompression::isCompressed(compressed.data(), sizeof(LzCompression::ContainerHeader) - 1));
+}
+
+TEST(LzCompressionTests, givenEmptyBlockDescriptorWhenDecompressingThenNullIsReturned) {
+    LzCompression::ContainerHeader header{};
+    header.blockSize = 1024u;
+    header.decompressedSize = 16u;
+    const uint32_t emptyBlockDescriptor = LzCompression::storedBlockFlag;
+
+    std::vector<char> compressed(sizeof(header) + sizeof(emptyBlockDescriptor));
+    memcpy_s(compressed.data(), compressed.size(), &header, sizeof(header));
+    memcpy_s(compressed.data() + sizeof(header), sizeof(emptyBlockDescriptor), &emptyBlockDescriptor, sizeof(emptyBlockDescriptor));
+
+    size_t decompressedSize = 0;
+    EXPECT_EQ(nullptr, LzCompression::decompress(compressed.data(), compressed.size(), decompressedSize, 1u, nullptr));
+    EXPECT_EQ(0u, decompressedSize);
+}
+
+TEST(LzCompressionTests, givenDecompressedSizeAboveCompressionRatioOrSizeLimitWhenDecompressingThenNullIsReturnedBeforeAllocating) {
+    auto data = createCompressibleData(4 * MemoryConstants::kiloByte);
+    auto compressed = LzCompression::compress(data.data(), data.size(), LzCompression::defaultBlockSize);
+
+    LzCompression::ContainerHeader header{};
+    memcpy_s(&header, sizeof(header), compressed.data(), sizeof(header));
+    header.decompressedSize = LzCompression::maxCompressionRatio * compressed.size() + 1;
+    memcpy_s(compressed.data(), compressed.size(), &header, sizeof(header));
+
+    size_t decompressedSize = 0;
+    EXPECT_EQ(nullptr, LzCompression::decompress(compressed.data(), compressed.size(), decompressedSize, 1u, nullptr));
+
+    header.decompressedSize = LzCompression::maxDecompressedSize + 1;
+    memcpy_s(compressed.data(), compressed.size(), &header, sizeof(header));
+    std::vector<char> largeContainer(static_cast<size_t>(header.decompressedSize / LzCompression::maxCompressionRatio) + 1);
+    memcpy_s(largeContainer.data(), largeContainer.size(), compressed.data(), compressed.size());
+    EXPECT_EQ(nullptr, LzCompression::decompress(largeContainer.data(), largeContainer.size(), decompressedSize, 1u, nullptr));
+    EXPECT_EQ(0u, decompressedSize);
+}
+
+TEST(LzCompressionTests, givenMatchTableUsedByPreviousBlockWhenCompressingBlockThenOutputIsSameAsWithFreshTable) {
+    std::vector<uint8_t> block(32 * MemoryConstants::kiloByte);
+    std::mt19937 generator(0);
+    for (size_t i = 0; i < block.size(); i++) {
+        // distant, non-overlapping repetitions of random bytes
+        block[i] = (i >= 4096 && i % 8192 < 1024) ? block[i - 4096] : static_cast<uint8_t>(generator());
+    }
+    // previous block starting with the same bytes leaves entries at positions not yet reached in the next block
+    std::vector<uint8_t> previousBlock(block.begin(), block.begin() + block.size() / 2);
+
+    std::vector<uint8_t> compressedPrevious(previousBlock.size());
+    LzCompression::MatchTable reusedTable(LzCompression::matchTableSize);
+    EXPECT_NE(0u, LzCompression::compressBlock(previousBlock.data(), previousBlock.size(), compressedPrevious.data(), compressedPrevious.size(), reusedTable));
+
+    std::vector<uint8_t> compressedWithReusedTable(block.size()), compressedWithFreshTable(block.size());
+    LzCompression::MatchTable freshTable(LzCompression::matchTableSize);
+    const auto sizeWithReusedTable = LzCompression::compressBlock(block.data(), block.size(), compressedWithReusedTable.data(), compressedWithReusedTable.size(), reusedTable);
+    const auto sizeWithFreshTable = LzCompression::compressBlock(block.data(), block.size(), compressedWithFreshTable.data(), compressedWithFreshTable.size(), freshTable);
+    ASSERT_NE(0u, sizeWithFreshTable);
+    ASSERT_EQ(sizeWithFreshTable, sizeWithReusedTable);
+    EXPECT_EQ(0, memcmp(compressedWithFreshTable.data(), compressedWithReusedTable.data(), sizeWithFreshTable));
+
+    std::vector<uint8_t> decompressed(block.size());
+    EXPECT_TRUE(LzCompression::decompressBlock(compressedWithFreshTable.data(), sizeWithFreshTable, decompressed.data(), decompressed.size()));
+    EXPECT_EQ(block, decompressed);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenWorkerPoolWhenRunningParallelForThenEachIndexIsProcessedOnce) {
+    WorkerPool workerPool(3u);
+    std::atomic<uint32_t> processedIndices[128] = {};
+    parallelFor(&workerPool, 128u, 8u, [&](size_t index) {
+        processedIndices[index]++;
+    });
+    for (const auto &processed : processedIndices) {
+        EXPECT_EQ(1u, processed.load());
+    }
+}
+
+TEST(ParallelForTest, givenNoWorkerPoolOrSingleThreadWhenRunningParallelForThenIndicesAreProcessedInOrderOnCallingThread) {
+    WorkerPool workerPool(3u);
+    for (auto pool : {static_cast<WorkerPool *>(nullptr), &workerPool}) {
+        const uint32_t maxThreads = pool == nullptr ? 8u : 1u;
+        std::vector<size_t> processedIndices;
+        std::set<std::thread::id> threadIds;
+        parallelFor(pool, 16u, maxThreads, [&](size_t index) {
+            processedIndices.push_back(index);
+            threadIds.insert(std::this_thread::get_id());
+        });
+        ASSERT_EQ(16u, processedIndices.size());
+        for (size_t i = 0; i < processedIndices.size(); i++) {
+            EXPECT_EQ(i, processedIndices[i]);
+        }
+        EXPECT_EQ(1u, threadIds.size());
+        EXPECT_EQ(1u, threadIds.count(std::this_thread::get_id()));
+    }
+}
+
+TEST(ParallelForTest, givenParallelForCalledFromWorkersOfSamePoolWhenRunningThenNestedCallsCompleteWithoutDeadlock) {
+    WorkerPool workerPool(2u);
+    std::atomic<uint32_t> processedItems{0};
+    parallelFor(&workerPool, 4u, 4u, [&](size_t) {
+        parallelFor(&workerPool, 4u, 4u, [&](size_t) { processedItems++; });
+    });
+    EXPECT_EQ(16u, processedItems.load());
+}
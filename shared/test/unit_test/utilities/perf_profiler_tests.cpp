@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/source/utilities/perf_trace.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
@@ -289,3 +291,78 @@ TEST(PerfProfiler, DISABLED_GivenSysLogBuilderWhenReadingAndWritingThenLogIsCorr
     EXPECT_EQ(timeW, timeR);
     EXPECT_EQ(idW, idR);
 }
+
+namespace CpuIntrinsicsTests {
+extern uint64_t rdtscRetValue;
+} // namespace CpuIntrinsicsTests
+
+TEST(PerfTraceBuffer, givenFullBufferWhenRecordingThenEventIsDroppedAndCountedUntilBufferIsConsumed) {
+    PerfTraceBuffer buffer(0u, 3u);
+    EXPECT_EQ(4u, buffer.getCapacity());
+
+    for (uint64_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(buffer.record("api", PerfTraceBuffer::EventType::api, 0u, i, i + 1));
+    }
+    EXPECT_FALSE(buffer.record("api", PerfTraceBuffer::EventType::api, 0u, 4u, 5u));
+    EXPECT_EQ(1u, buffer.getDroppedEventsCount());
+
+    uint64_t expectedStart = 0;
+    EXPECT_EQ(4u, buffer.consume([&](const PerfTraceEvent &event) {
+        EXPECT_EQ(expectedStart, event.start);
+        expectedStart++;
+    }));
+    EXPECT_EQ(0u, buffer.consume([](const PerfTraceEvent &event) {}));
+
+    EXPECT_TRUE(buffer.record("api", PerfTraceBuffer::EventType::api, 0u, 5u, 6u));
+    EXPECT_EQ(1u, buffer.consume([](const PerfTraceEvent &event) {}));
+}
+
+TEST(PerfTracer, givenRecordedEventsWhenFlushingThenChromeTraceEventsRelativeToTracerCreationAreWritten) {
+    VariableBackup<uint64_t> rdtscBackup(&CpuIntrinsicsTests::rdtscRetValue, 1000u);
+    auto output = std::make_unique<std::stringstream>();
+    auto outputStream = output.get();
+    PerfTracer tracer(std::move(output), 16u, 0u, 1.0);
+
+    auto buffer = tracer.createThreadBuffer();
+    EXPECT_EQ(16u, buffer->getCapacity());
+    buffer->record("clFinish", PerfTraceBuffer::EventType::api, 0u, 3000u, 5000u);
+    buffer->record(nullptr, PerfTraceBuffer::EventType::system, 7u, 3500u, 4000u);
+
+    EXPECT_EQ(2u, tracer.flush());
+    EXPECT_EQ(2u, tracer.getWrittenEventsCount());
+    EXPECT_EQ(0u, tracer.flush());
+
+    auto trace = outputStream->str();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"clFinish\",\"cat\":\"api\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":0,\"ts\":2.000,\"dur\":2.000}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"system\",\"cat\":\"system\",\"args\":{\"id\":7}"));
+    EXPECT_NE(std::string::npos, trace.find("\"ts\":2.500,\"dur\":0.500}"));
+}
+
+TEST(PerfProfiler, givenTraceBufferWhenApiAndSystemCallsAreProfiledThenEventsAreRecordedInsteadOfXmlLogs) {
+    VariableBackup<uint64_t> rdtscBackup(&CpuIntrinsicsTests::rdtscRetValue, 100u);
+    PerfTraceBuffer buffer(0u, 4u);
+    PerfProfiler profiler(&buffer);
+    EXPECT_EQ(nullptr, profiler.getLogStream());
+    EXPECT_EQ(nullptr, profiler.getSystemLogStream());
+
+    profiler.apiEnter();
+    CpuIntrinsicsTests::rdtscRetValue = 200u;
+    profiler.systemEnter();
+    CpuIntrinsicsTests::rdtscRetValue = 300u;
+    profiler.systemLeave(3u);
+    CpuIntrinsicsTests::rdtscRetValue = 400u;
+    profiler.apiLeave("clFinish");
+
+    std::vector<PerfTraceEvent> events;
+    EXPECT_EQ(2u, buffer.consume([&](const PerfTraceEvent &event) { events.push_back(event); }));
+    EXPECT_EQ(static_cast<uint32_t>(PerfTraceBuffer::EventType::system), events[0].type);
+    EXPECT_EQ(3u, events[0].systemId);
+    EXPECT_EQ(200u, events[0].start);
+    EXPECT_EQ(300u, events[0].end);
+    EXPECT_EQ(static_cast<uint32_t>(PerfTraceBuffer::EventType::api), events[1].type);
+    EXPECT_STREQ("clFinish", events[1].name);
+    EXPECT_EQ(100u, events[1].start);
+    EXPECT_EQ(400u, events[1].end);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/windows/sys_calls.h"
+#include "shared/source/utilities/mapped_file.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+namespace NEO {
+namespace SysCalls {
+extern size_t closeHandleCalled;
+
+extern size_t createFileACalled;
+extern HANDLE createFileAResults[];
+
+extern size_t getFileSizeExCalled;
+extern BOOL getFileSizeExResult;
+extern LONGLONG getFileSizeExFileSize;
+
+extern size_t createFileMappingACalled;
+extern HANDLE createFileMappingAResult;
+
+extern size_t mapViewOfFileCalled;
+extern LPVOID mapViewOfFileResult;
+
+extern size_t unmapViewOfFileCalled;
+} // namespace SysCalls
+} // namespace NEO
+
+using namespace NEO;
+
+struct MappedFileWindowsTest : public ::testing::Test {
+    void SetUp() override {
+        SysCalls::createFileAResults[0] = reinterpret_cast<HANDLE>(0x1234);
+    }
+
+    void TearDown() override {
+        SysCalls::createFileAResults[0] = nullptr;
+    }
+
+    uint8_t fileData[64] = {};
+    VariableBackup<size_t> closeHandleCalledBackup{&SysCalls::closeHandleCalled, 0u};
+    VariableBackup<size_t> createFileACalledBackup{&SysCalls::createFileACalled, 0u};
+    VariableBackup<size_t> getFileSizeExCalledBackup{&SysCalls::getFileSizeExCalled, 0u};
+    VariableBackup<BOOL> getFileSizeExResultBackup{&SysCalls::getFileSizeExResult, TRUE};
+    VariableBackup<LONGLONG> getFileSizeExFileSizeBackup{&SysCalls::getFileSizeExFileSize, sizeof(fileData)};
+    VariableBackup<size_t> createFileMappingACalledBackup{&SysCalls::createFileMappingACalled, 0u};
+    VariableBackup<HANDLE> createFileMappingAResultBackup{&SysCalls::createFileMappingAResult, reinterpret_cast<HANDLE>(0x5678)};
+    VariableBackup<size_t> mapViewOfFileCalledBackup{&SysCalls::mapViewOfFileCalled, 0u};
+    VariableBackup<LPVOID> mapViewOfFileResultBackup{&SysCalls::mapViewOfFileResult, fileData};
+    VariableBackup<size_t> unmapViewOfFileCalledBackup{&SysCalls::unmapViewOfFileCalled, 0u};
+};
+
+TEST_F(MappedFileWindowsTest, givenExistingFileWhenMappingThenViewOfWholeFileIsReturnedAndHandlesAreClosed) {
+    auto mappedFile = MappedFile::map("file.bin");
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_TRUE(mappedFile->isMemoryMapped());
+    EXPECT_EQ(fileData, mappedFile->getData().begin());
+    EXPECT_EQ(sizeof(fileData), mappedFile->getData().size());
+    EXPECT_EQ(1u, SysCalls::mapViewOfFileCalled);
+    EXPECT_EQ(2u, SysCalls::closeHandleCalled);
+
+    mappedFile.reset();
+    EXPECT_EQ(1u, SysCalls::unmapViewOfFileCalled);
+}
+
+TEST_F(MappedFileWindowsTest, givenCreateFileFailureWhenMappingThenNullptrIsReturned) {
+    SysCalls::createFileAResults[0] = INVALID_HANDLE_VALUE;
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(0u, SysCalls::getFileSizeExCalled);
+    EXPECT_EQ(0u, SysCalls::closeHandleCalled);
+}
+
+TEST_F(MappedFileWindowsTest, givenGetFileSizeFailureWhenMappingThenNullptrIsReturnedAndFileIsClosed) {
+    SysCalls::getFileSizeExResult = FALSE;
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(0u, SysCalls::createFileMappingACalled);
+    EXPECT_EQ(1u, SysCalls::closeHandleCalled);
+}
+
+TEST_F(MappedFileWindowsTest, givenCreateFileMappingFailureWhenMappingThenNullptrIsReturnedAndFileIsClosed) {
+    SysCalls::createFileMappingAResult = nullptr;
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(0u, SysCalls::mapViewOfFileCalled);
+    EXPECT_EQ(1u, SysCalls::closeHandleCalled);
+}
+
+TEST_F(MappedFileWindowsTest, givenMapViewOfFileFailureWhenMappingThenNullptrIsReturnedAndBothHandlesAreClosed) {
+    SysCalls::mapViewOfFileResult = nullptr;
+    EXPECT_EQ(nullptr, MappedFile::map("file.bin"));
+    EXPECT_EQ(1u, SysCalls::mapViewOfFileCalled);
+    EXPECT_EQ(2u, SysCalls::closeHandleCalled);
+}
+
+TEST_F(MappedFileWindowsTest, givenEmptyFileWhenMappingThenEmptyViewIsReturnedWithoutMapping) {
+    SysCalls::getFileSizeExFileSize = 0;
+    auto mappedFile = MappedFile::map("file.bin");
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_FALSE(mappedFile->isMemoryMapped());
+    EXPECT_TRUE(mappedFile->getData().empty());
+    EXPECT_EQ(0u, SysCalls::createFileMappingACalled);
+    EXPECT_EQ(1u, SysCalls::closeHandleCalled);
+
+    mappedFile.reset();
+    EXPECT_EQ(0u, SysCalls::unmapViewOfFileCalled);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <set>
+
+using namespace NEO;
+
+TEST(WorkerPoolTest, givenTasksEnqueuedWhenPoolIsDestroyedThenAllTasksAreExecuted) {
+    std::atomic<uint32_t> executedTasks = 0;
+    {
+        WorkerPool workerPool(3u);
+        EXPECT_EQ(3u, workerPool.getWorkersCount());
+        for (uint32_t i = 0; i < 64u; i++) {
+            workerPool.enqueue([&executedTasks]() { executedTasks++; });
+        }
+    }
+    EXPECT_EQ(64u, executedTasks.load());
+}
+
+TEST(WorkerPoolTest, givenWorkSplitDynamicallyWhenRunningInParallelThenAllItemsAreProcessedOnceBeforeReturning) {
+    WorkerPool workerPool(3u);
+    std::atomic<uint32_t> nextItem = 0;
+    std::atomic<uint32_t> processedItems[256] = {};
+    workerPool.runInParallel(8u, [&]() {
+        for (auto item = nextItem++; item < 256u; item = nextItem++) {
+            processedItems[item]++;
+        }
+    });
+    for (const auto &processed : processedItems) {
+        EXPECT_EQ(1u, processed.load());
+    }
+}
+
+TEST(WorkerPoolTest, givenPoolWithoutWorkersWhenRunningInParallelThenWorkRunsOnCallingThreadOnly) {
+    WorkerPool workerPool(0u);
+    std::set<std::thread::id> threadIds;
+    workerPool.runInParallel(4u, [&]() { threadIds.insert(std::this_thread::get_id()); });
+    ASSERT_EQ(1u, threadIds.size());
+    EXPECT_EQ(std::this_thread::get_id(), *threadIds.begin());
+}
+
+TEST(WorkerPoolTest, givenAllWorkersBusyWithNestedParallelRunsWhenRunningInParallelThenRunsCompleteWithoutDeadlock) {
+    WorkerPool workerPool(2u);
+    std::atomic<uint32_t> executedItems = 0;
+    workerPool.runInParallel(2u, [&]() {
+        workerPool.runInParallel(2u, [&]() { executedItems++; });
+    });
+    EXPECT_LE(1u, executedItems.load());
+}